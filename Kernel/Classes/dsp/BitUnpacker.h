@@ -48,10 +48,21 @@ namespace dsp {
 
     //! The bit table generator  
     Reference::To<BitTable> table;
+
+    //! Return true if the table can be replaced by UnpackKernel
+    bool get_linear_table () const;
     
     //! Unpack all channels, polarizations, real/imag, etc.
     virtual void unpack ();
 
+  private:
+
+    //! The table last tested by get_linear_table
+    mutable Reference::To<const BitTable> linear_table;
+
+    //! The result of the last test
+    mutable bool linear_result;
+
   };
 
 }
@@ -48,6 +48,11 @@ namespace dsp {
     static File* create (const std::string& filename)
     { return create (filename.c_str()); }
 
+    //! Return a pointer to a new instance of the named sub-class
+    /*! Use this method when the format is already known (e.g. all of
+      the files in a MultiFile set) to avoid testing every format */
+    static File* create (const char* filename, const std::string& format);
+
     //! Constructor
     File (const char* name);
     
@@ -0,0 +1,146 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/FormatCache.h
+
+#ifndef __dsp_FormatCache_h
+#define __dsp_FormatCache_h
+
+#include "ReferenceAble.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <deque>
+
+class ThreadContext;
+
+namespace dsp {
+
+  //! Suggests the order in which File formats are tested by File::create
+  /*! File::create tests every registered File sub-class until one of
+    them returns true from is_valid.  For large numbers of files, this
+    probing can dominate the start-up time.  The FormatCache suggests
+    the formats to be tested first, in the following order:
+
+    - the format previously used to open the same file;
+    - the format previously used to open a file with the same name
+      pattern (the same directory and the same name after each run of
+      digits is replaced by '#'), so that after the first file of a
+      sequence of segments is found, the remainder are opened by the
+      first test;
+    - the format suggested by a signature in the first bytes of the
+      file (e.g. a FITS, SigProc, GUPPI or DADA header); and
+    - the format suggested by the file name extension.
+
+    The decision is still made by File::is_valid, so a stale or
+    incorrect suggestion costs at most one extra test.  Formats whose
+    is_valid test is weak (see File_registry.C) are never suggested.
+
+    If the DSPSR_FORMAT_CACHE environment variable is set, the cache
+    is loaded from the named file when first used, and saved when
+    flush is called (e.g. after MultiFile has opened all of its
+    members) and at exit, so that the choices made in one run are
+    remembered in the next.  The number of files and patterns
+    remembered is limited; the oldest entries are forgotten first. */
+  class FormatCache : public Reference::Able
+  {
+  public:
+
+    //! Verbosity flag
+    static bool verbose;
+
+    //! Maximum number of file names remembered
+    static unsigned max_files;
+
+    //! Maximum number of file name patterns remembered
+    static unsigned max_patterns;
+
+    //! Return the cache shared by all calls to File::create
+    static FormatCache* get_instance ();
+
+    //! Default constructor
+    FormatCache ();
+
+    //! Destructor
+    ~FormatCache ();
+
+    //! Return the names of formats to test first, most likely first
+    std::vector<std::string> get_candidates (const std::string& fname) const;
+
+    //! Record the name of the format used to open the named file
+    void add (const std::string& fname, const std::string& format);
+
+    //! Return the format previously used to open fname (if any)
+    std::string lookup (const std::string& fname) const;
+
+    //! Return the format previously used to open a file like fname (if any)
+    std::string lookup_pattern (const std::string& fname) const;
+
+    //! Forget all remembered formats
+    void clear ();
+
+    //! Set the name of the file in which the cache is persisted
+    void set_filename (const std::string& fname);
+
+    //! Load the cache from file
+    void load ();
+
+    //! Save the cache to file
+    void unload () const;
+
+    //! Save the cache to file if it has changed since last saved
+    void flush ();
+
+    //! Return the format suggested by the first bytes of the file
+    static std::string sniff (const std::string& fname);
+
+    //! Return the format suggested by the file name extension
+    static std::string extension (const std::string& fname);
+
+    //! Return the file name pattern shared by a sequence of files
+    static std::string pattern (const std::string& fname);
+
+    //! Return true if the format may be tested before registry order
+    static bool suggestible (const std::string& format);
+
+  protected:
+
+    //! Format names indexed by key, forgetting the oldest beyond a limit
+    class Index
+    {
+    public:
+      std::string lookup (const std::string& key) const;
+      bool set (const std::string& key, const std::string& format,
+                unsigned max_size);
+      void clear ();
+
+      std::map<std::string,std::string> format;
+      std::deque<std::string> age;
+    };
+
+    //! Format names indexed by file name
+    Index file_format;
+
+    //! Format names indexed by file name pattern
+    Index pattern_format;
+
+    //! True when the cache has changed since last saved
+    bool modified;
+
+    //! The file in which the cache is persisted
+    std::string filename;
+
+    //! Protects the maps when File::create is called by multiple threads
+    ThreadContext* context;
+
+  };
+
+}
+
+#endif // !defined(__dsp_FormatCache_h)
@@ -82,6 +82,9 @@ namespace dsp {
     // (should not normally need to be used)
     virtual void set_output (BitSeries* output);
 
+    //! Get the BitSeries into which data are loaded
+    const BitSeries* get_output () const;
+
     //! Set the maximum RAM usage constraint in set_block_size
     void set_maximum_RAM (uint64_t);
     //! Set the minimum RAM usage constraint in set_block_size
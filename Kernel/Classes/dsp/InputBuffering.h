@@ -16,6 +16,7 @@
 namespace dsp {
 
   class Reserve;
+  class RingTimeSeries;
 
   //! Buffers the Transformation input
   class InputBuffering : public BufferingPolicy
@@ -52,9 +53,15 @@ namespace dsp {
 
   protected:
     
+    //! Return the input if it is a RingTimeSeries
+    RingTimeSeries* get_ring ();
+
     //! The next start sample
     uint64_t next_start_sample;
 
+    //! The sample following the data retained in a RingTimeSeries
+    int64_t ring_next_contiguous;
+
      //! The target with input TimeSeries to be buffered
     HasInput<TimeSeries>* target;
     
@@ -0,0 +1,89 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/MPIChannelGather.h
+
+#ifndef __MPIChannelGather_h
+#define __MPIChannelGather_h
+
+#include <mpi.h>
+
+#include "dsp/Transformation.h"
+#include "dsp/BitSeries.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Gathers the channels of digitized data from MPI processes
+  /*! Each process in the communicator provides the same number of
+    channels of the same time samples, in time, polarization, frequency
+    order (as output by SigProcDigitizer); the number of bits in the
+    channels of each polarization must be a multiple of 8.  On the root
+    process, the channels of all processes are combined in order of
+    decreasing frequency, and the output describes the band that was
+    divided (see set_band); on all other processes, the output is empty.
+
+    This is a collective operation, which must be performed on every
+    block of data by all processes. */
+  class MPIChannelGather : public Transformation<BitSeries,BitSeries>
+  {
+
+  public:
+
+    //! Constructor
+    MPIChannelGather (MPI_Comm comm);
+
+    //! Get the number of processes in the communicator
+    int get_size () const { return mpi_size; }
+
+    //! Get the rank of this process within the communicator
+    int get_rank () const { return mpi_rank; }
+
+    //! Get the rank of the process that receives the data
+    int get_root () const { return mpi_root; }
+    //! Set the rank of the process that receives the data
+    void set_root (int root);
+
+    //! Set the observation that describes the band that was divided
+    /*! The centre frequency of the output is set to that of the band */
+    void set_band (const Observation* band);
+
+  protected:
+
+    //! Gather the channels on the root process
+    void transformation ();
+
+    //! Determine the order of the processes in the output
+    void prepare_gather ();
+
+    //! The band that was divided between processes
+    Reference::To<const Observation> band;
+
+    //! The ranks of the processes in order of decreasing frequency
+    std::vector<int> order;
+
+    //! The data received from all processes
+    std::vector<unsigned char> buffer;
+
+    //! The communicator
+    MPI_Comm mpi_comm;
+
+    //! The number of processes in the communicator
+    int mpi_size;
+
+    //! The rank of this process
+    int mpi_rank;
+
+    //! The rank of the process that receives the data
+    int mpi_root;
+  };
+
+}
+
+#endif // !defined(__MPIChannelGather_h)
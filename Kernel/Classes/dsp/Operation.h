@@ -12,6 +12,7 @@
 #define __Operation_h
 
 #include "dsp/dsp.h"
+#include "dsp/OperationStats.h"
 
 #include "RealTimer.h"
 #include "OwnStream.h"
@@ -95,6 +96,14 @@ namespace dsp {
     //! Get the time spent in the last invocation of operate()
     double get_elapsed_time() const;
 
+    //! Return the performance counters
+    const OperationStats& get_stats () const { return stats; }
+
+    //! Add to the wait time of the operation running in the calling thread
+    /*! Called by objects that wait for other threads, such as
+      InputBuffering::Share; ignored unless record_time is enabled */
+    static void add_wait_time (double seconds);
+
     //! Return the total number of timesample weights encountered
     virtual uint64_t get_total_weights () const;
 
@@ -147,6 +156,9 @@ namespace dsp {
     //! Stop watch records the amount of time spent performing this operation
     RealTimer optime;
 
+    //! Performance counters updated when record_time is enabled
+    OperationStats stats;
+
     //! Unique instantiation id
     int id;
 
@@ -0,0 +1,91 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/OperationStats.h
+
+#ifndef __dsp_OperationStats_h
+#define __dsp_OperationStats_h
+
+#include "environ.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace dsp {
+
+  class Operation;
+  class Observation;
+
+  //! Performance counters accumulated by an Operation
+  /*! Counters are updated only when Operation::record_time is enabled */
+  class OperationStats
+  {
+  public:
+
+    //! Default constructor
+    OperationStats ();
+
+    //! Reset all counters to zero
+    void reset ();
+
+    //! Add the counters of another instance
+    OperationStats& operator += (const OperationStats&);
+
+    //! Number of calls to Operation::operate
+    uint64_t calls;
+
+    //! Number of time samples input
+    uint64_t ndat_in;
+
+    //! Number of time samples output
+    uint64_t ndat_out;
+
+    //! Number of bytes input
+    uint64_t bytes_in;
+
+    //! Number of bytes output
+    uint64_t bytes_out;
+
+    //! Wall-clock time spent in Operation::operate
+    double wall_time;
+
+    //! CPU time spent in Operation::operate by the calling thread
+    double cpu_time;
+
+    //! Time spent waiting for other threads
+    double wait_time;
+
+    //! Number of times that the operation waited for other threads
+    uint64_t nwait;
+
+    //! Return the CPU time used by the calling thread in seconds
+    static double get_cpu_time ();
+
+    //! Write a table of the counters of each operation
+    /*! If csv is true, the output is comma-separated values;
+      otherwise, it is a JSON array with one object per operation.
+      Throughput is computed from the input counters, or from the
+      output counters of sources (e.g. Input) that have no input. */
+    static void write (std::ostream&, const std::vector<const Operation*>&,
+                       bool csv = false);
+
+    //! Write the counters of each operation to the named file
+    /*! CSV is written if the file name ends in .csv; otherwise JSON */
+    static void write (const std::string& filename,
+                       const std::vector<const Operation*>&);
+  };
+
+  //! Add the number of samples and bytes in the container to the counters
+  void count_data (const Observation*, uint64_t& ndat, uint64_t& nbytes);
+
+  //! Containers that are not Observations are not counted
+  inline void count_data (const void*, uint64_t&, uint64_t&) { }
+}
+
+#endif // !defined(__dsp_OperationStats_h)
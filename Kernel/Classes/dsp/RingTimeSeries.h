@@ -0,0 +1,81 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/RingTimeSeries.h
+
+#ifndef __RingTimeSeries_h
+#define __RingTimeSeries_h
+
+#include "dsp/TimeSeries.h"
+
+namespace dsp {
+
+  //! TimeSeries stored in double-mapped ring buffers
+  /*! Each channel and polarization (or, in TFP order, all of the data)
+    is stored in a ring of shared memory that is mapped twice at
+    consecutive virtual addresses, so that any window of up to one ring
+    length is contiguous.  When InputBuffering retains the end of the
+    current block, the next call to resize places the new data directly
+    after the retained samples, which are then recovered by seeking
+    backwards instead of being copied out and prepended. */
+  class RingTimeSeries : public TimeSeries {
+
+  public:
+
+    //! Default constructor
+    RingTimeSeries ();
+
+    //! Destructor
+    ~RingTimeSeries ();
+
+    //! Set the number of samples in the window following any retained data
+    void resize (uint64_t nsamples);
+
+    //! Retain the samples from idat to the end of the current data
+    void retain (uint64_t idat);
+
+    //! Get the number of retained samples directly preceding the data
+    uint64_t get_retained () const { return retained; }
+
+    //! Keep only the first nkeep retained samples, directly preceding the data
+    void trim_retained (uint64_t nkeep);
+
+    //! Forget the retained samples
+    void discard_retained () { retained = 0; }
+
+  protected:
+
+    //! Allocate rings of at least nbyte each, preserving retained data
+    void allocate (uint64_t nbyte, unsigned nring);
+
+    //! Release the mapped memory
+    void deallocate ();
+
+    //! Base of the mapped memory
+    unsigned char* base;
+
+    //! Size of each ring in bytes
+    uint64_t ring_size;
+
+    //! Number of rings
+    unsigned nring;
+
+    //! Start of the retained data, in samples from the current data
+    uint64_t retain_start;
+
+    //! Retained data will be placed before the data at the next resize
+    bool retain_pending;
+
+    //! Number of retained samples directly preceding the data
+    uint64_t retained;
+
+  };
+
+}
+
+#endif // !defined(__RingTimeSeries_h)
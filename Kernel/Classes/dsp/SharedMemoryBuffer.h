@@ -0,0 +1,87 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/SharedMemoryBuffer.h
+
+#ifndef __dsp_SharedMemoryBuffer_h
+#define __dsp_SharedMemoryBuffer_h
+
+#include "dsp/File.h"
+#include "dsp/SharedMemoryRing.h"
+
+namespace dsp {
+
+  //! Loads BitSeries data from a SharedMemoryRing
+  /*! Like DADABuffer, this class pretends to be a file so that it can
+    slip into the File::registry.  The "file" is a text file with the
+    following contents:
+
+    SHM INFO:
+    name /dspsr
+
+    where the name is that of the POSIX shared memory segment.  The
+    data are described by the ASCII (DADA) header in the ring, and are
+    copied directly from the blocks of the ring into each BitSeries.
+    Blocks dropped by the writer are replaced by zeros.
+    The shm_replay program writes any file into a ring in real time. */
+  class SharedMemoryBuffer : public File
+  {
+
+  public:
+
+    //! Constructor
+    SharedMemoryBuffer ();
+
+    //! Destructor
+    ~SharedMemoryBuffer ();
+
+    //! Returns true if filename is a shared memory INFO file
+    bool is_valid (const char* filename) const;
+
+    //! Ensure that block_size is an integer multiple of resolution
+    void set_block_size (uint64_t _size);
+
+    //! Get the ring from which data are loaded
+    const SharedMemoryRing* get_ring () const { return ring; }
+
+  protected:
+
+    //! Read the segment name from the INFO file and attach to the ring
+    void open_file (const char* filename);
+
+    //! Detach from the ring
+    void close ();
+
+    //! Copy bytes from the ring
+    int64_t load_bytes (unsigned char* buffer, uint64_t bytes);
+
+    //! The ring can only be read forward
+    int64_t seek_bytes (uint64_t bytes);
+
+    //! The total number of samples is not known
+    void set_total_samples () { }
+
+    //! The ring of data blocks in shared memory
+    Reference::To<SharedMemoryRing> ring;
+
+    //! Return the number of bytes dropped between offset and the current view
+    uint64_t get_gap (uint64_t offset);
+
+    //! The offset in the stream of the next byte to be loaded
+    uint64_t released;
+
+    //! The number of dropped bytes that were replaced by zeros
+    uint64_t dropped;
+
+    //! The end of the last gap reported
+    uint64_t gap_end;
+  };
+
+}
+
+#endif // !defined(__dsp_SharedMemoryBuffer_h)
@@ -0,0 +1,189 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/SharedMemoryRing.h
+
+#ifndef __dsp_SharedMemoryRing_h
+#define __dsp_SharedMemoryRing_h
+
+#include "ReferenceAble.h"
+
+#include <string>
+#include <inttypes.h>
+
+namespace dsp {
+
+  //! A ring of data blocks in POSIX shared memory
+  /*! One process creates the ring and writes blocks; another process
+    attaches to the ring and reads them.  The segment contains a small
+    control area (process-shared mutex and condition variable, block
+    counters, and the size, stream offset and time at which each block
+    was filled), an ASCII
+    (DADA) header that describes the data, and the blocks themselves.
+
+    Both sides operate directly on views of the blocks in the segment:
+    the writer fills the memory returned by open_block, and the reader
+    consumes the memory returned by view.  When the reader falls behind
+    by more than the number of blocks in the ring, the writer either
+    waits or drops the block, as it would in a real-time system.  The
+    writer records the dropped bytes with skip_bytes, so that the reader
+    can detect the gap from the stream offset of the next block.
+
+    The control area records the process identifier of the reader, so
+    that a new reader may attach after the previous reader has died
+    without detaching, and the mutex is robust, so that the ring
+    remains usable when a process dies while holding it. */
+  class SharedMemoryRing : public Reference::Able
+  {
+
+  public:
+
+    //! Default constructor
+    SharedMemoryRing ();
+
+    //! Destructor detaches from (and, if created, unlinks) the segment
+    ~SharedMemoryRing ();
+
+    //! Create a new segment with the specified name
+    void create (const std::string& name, unsigned nblock,
+                 uint64_t block_size, unsigned header_size = 4096);
+
+    //! Attach to an existing segment as the reader
+    /*! Throws an exception if another living process is the reader */
+    void attach (const std::string& name);
+
+    //! Detach from the segment
+    void detach ();
+
+    //! Get the name of the segment
+    const std::string& get_name () const { return name; }
+
+    //! Get the number of blocks in the ring
+    unsigned get_nblock () const;
+
+    //! Get the size of each block in bytes
+    uint64_t get_block_size () const;
+
+    /** @name writer methods */
+    //@{
+
+    //! Set the ASCII header that describes the data
+    void set_header (const char* header);
+
+    //! Wait until a reader has attached
+    void wait_reader ();
+
+    //! Return the next free block, or null if full and wait is false
+    unsigned char* open_block (bool wait);
+
+    //! Mark the block returned by open_block as containing nbyte bytes
+    void close_block (uint64_t nbyte);
+
+    //! Advance the stream offset past nbyte bytes that were not written
+    void skip_bytes (uint64_t nbyte);
+
+    //! Mark the end of data
+    void set_eod ();
+
+    //! Wait until the reader has consumed all blocks
+    void wait_empty ();
+
+    //@}
+
+    /** @name reader methods */
+    //@{
+
+    //! Wait for and return the ASCII header
+    std::string get_header ();
+
+    //! Wait for and return the unread bytes of the current block
+    /*! Returns null at the end of data */
+    const unsigned char* view (uint64_t& nbyte);
+
+    //! Release the first nbyte bytes of the current view
+    void release (uint64_t nbyte);
+
+    //! Get the offset in the stream of the first byte of the current view
+    uint64_t get_view_offset () const { return view_offset; }
+
+    //@}
+
+    /** @name statistics */
+    //@{
+
+    //! Number of blocks written
+    uint64_t get_written () const;
+
+    //! Number of blocks consumed by the reader
+    uint64_t get_read () const;
+
+    //! Number of blocks dropped because the ring was full
+    uint64_t get_dropped () const;
+
+    //! Largest time between filling and consuming a block, in seconds
+    double get_max_latency () const { return max_latency; }
+
+    //! Mean time between filling and consuming a block, in seconds
+    double get_mean_latency () const;
+
+    //@}
+
+    //! The current time in seconds, as used for the block time stamps
+    static double now ();
+
+  protected:
+
+    //! The control area at the start of the segment
+    struct Control;
+
+    //! Map the segment with the specified file descriptor
+    void map (int fd, uint64_t size);
+
+    //! Pointer to the control area
+    Control* control;
+
+    //! Number of bytes in each block
+    uint64_t* block_nbyte;
+
+    //! Offset in the stream of the first byte of each block
+    uint64_t* block_offset;
+
+    //! Time at which each block was filled
+    double* block_time;
+
+    //! The ASCII header
+    char* header;
+
+    //! The first block
+    unsigned char* data;
+
+    //! The address and size of the mapped segment
+    void* mapped;
+    uint64_t mapped_size;
+
+    //! The name of the segment
+    std::string name;
+
+    //! True if this instance created the segment
+    bool owner;
+
+    //! Bytes of the current block already released by the reader
+    uint64_t read_offset;
+
+    //! Offset in the stream of the first byte of the current view
+    uint64_t view_offset;
+
+    //! Latency statistics of the reader
+    double max_latency;
+    double total_latency;
+    uint64_t nlatency;
+  };
+
+}
+
+#endif // !defined(__dsp_SharedMemoryRing_h)
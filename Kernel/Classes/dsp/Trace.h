@@ -0,0 +1,97 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/Trace.h
+
+#ifndef __dsp_Trace_h
+#define __dsp_Trace_h
+
+#include "environ.h"
+
+#include <string>
+
+namespace dsp {
+
+  //! Records a timeline of pipeline events in the Chrome trace format
+  /*! When enabled, each thread records the beginning and end of events,
+    such as calls to Operation::operate, waits for locks held by other
+    threads and the loading of blocks of data, into its own ring buffer.
+    Recording does not require any locks; when a ring buffer is full,
+    the oldest events are overwritten.
+
+    The timeline is written as a JSON array of Chrome trace events,
+    which can be viewed with chrome://tracing or Perfetto.
+
+    When disabled (the default), the cost of each trace point is a
+    single test of Trace::enabled. */
+  class Trace
+  {
+  public:
+
+    //! Global flag enables recording of events
+    static bool enabled;
+
+    //! Set the number of events held by the ring buffer of each thread
+    /*! Applies only to threads that have not yet recorded an event */
+    static void set_capacity (unsigned nevent);
+
+    //! Return the current time in microseconds
+    static double now ();
+
+    //! Record an event that began and ended at the specified times
+    /*! The category must be a string literal */
+    static void add (const char* name, const char* category,
+                     double start, double end);
+
+    //! Write the events recorded by all threads to the named file
+    /*! Must not be called while other threads are recording */
+    static void unload (const std::string& filename);
+
+    //! Discard the events recorded by all threads
+    static void clear ();
+
+    //! Records an event that lasts for the lifetime of this instance
+    class Scope
+    {
+    public:
+
+      //! Begin the event; both name and category must outlive this instance
+      Scope (const char* _name, const char* _category)
+      {
+        name = 0;
+        if (enabled)
+        {
+          name = _name;
+          category = _category;
+          start = now ();
+        }
+      }
+
+      //! End the event (if not already ended)
+      ~Scope () { end (); }
+
+      //! End the event before the end of the scope
+      void end ()
+      {
+        if (name)
+          add (name, category, start, now ());
+        name = 0;
+      }
+
+    protected:
+
+      const char* name;
+      const char* category;
+      double start;
+    };
+
+  };
+
+}
+
+#endif // !defined(__dsp_Trace_h)
@@ -226,11 +226,18 @@ void dsp::Transformation<In, Out>::operation () try
     buffering_policy -> pre_transformation ();
   }
 
+  if (Operation::record_time)
+    count_data (this->input.get(), this->stats.ndat_in, this->stats.bytes_in);
+
   if (Operation::verbose)
     cerr << name("operation") << " transformation" << std::endl;
 
   transformation ();
 
+  if (Operation::record_time)
+    count_data (this->output.get(), this->stats.ndat_out,
+                this->stats.bytes_out);
+
   if (buffering_policy) {
     if (Operation::verbose)
       cerr << name("operation") << " post_transformation" << std::endl;
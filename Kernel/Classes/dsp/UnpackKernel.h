@@ -0,0 +1,102 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Kernel/Classes/dsp/UnpackKernel.h
+
+#ifndef __dsp_UnpackKernel_h
+#define __dsp_UnpackKernel_h
+
+#include "environ.h"
+
+namespace dsp {
+
+  class BitTable;
+
+  //! Branchless, look-up table free conversion of N-bit integers to float
+  /*! These kernels are shared by the CPU unpackers of many backends.
+    Each N-bit integer, x, is decoded as either two's complement or
+    offset binary and converted to floating point as (x + offset) * scale.
+    With offset = 0.5 and scale = BitTable::get_scale, the result is
+    identical to that of the look-up table generated by a BitTable with
+    the same number of bits and digitization convention.
+
+    The instruction set used by the kernels is chosen at run time.
+    Vectorised implementations are available for AVX2; on other
+    processors, or for strides that cannot be vectorised, a portable
+    branchless loop is used. */
+  class UnpackKernel
+  {
+  public:
+
+    //! Instruction sets for which implementations are available
+    enum Instructions { Generic, AVX2 };
+
+    //! Return the instruction set used by the kernels
+    static Instructions get_instructions ();
+
+    //! Set the instruction set used by the kernels
+    /*! Throws an exception if the processor does not support it */
+    static void set_instructions (Instructions);
+
+    //! Return true if the processor supports the instruction set
+    static bool supported (Instructions);
+
+    //! Return true if the BitTable can be replaced by these kernels
+    static bool linear (const BitTable*);
+
+    //! Unpack ndat 8-bit samples spaced by nskip bytes into every fskip float
+    static void eight_bit (uint64_t ndat,
+                           const unsigned char* from, unsigned nskip,
+                           float* into, unsigned fskip,
+                           float offset, float scale, bool twos);
+
+    //! Unpack nblock blocks of block_size consecutive 8-bit samples
+    /*! Blocks start every from_stride bytes in the input and every
+      into_stride floats in the output.  This de-interleaves data in
+      which several channels, polarizations or dimensions are packed
+      together. */
+    static void eight_bit_block (uint64_t nblock, unsigned block_size,
+                                 const unsigned char* from,
+                                 unsigned from_stride,
+                                 float* into, unsigned into_stride,
+                                 float offset, float scale, bool twos);
+
+    //! Unpack ndat 4-bit samples (two per byte)
+    /*! Consecutive bytes are spaced by nskip and each pair of samples
+      is written to into[0] and into[fskip] */
+    static void four_bit (uint64_t ndat,
+                          const unsigned char* from, unsigned nskip,
+                          float* into, unsigned fskip,
+                          float offset, float scale, bool twos,
+                          bool least_significant_first);
+
+    //! Unpack ndat 16-bit samples spaced by nskip into every fskip float
+    static void sixteen_bit (uint64_t ndat,
+                             const int16_t* from, unsigned nskip,
+                             float* into, unsigned fskip,
+                             float offset, float scale, bool twos);
+
+    //! Count the occurence of each byte value, XORed with flip
+    /*! For example, flip = 0x80 counts signed bytes from -128 to 127 */
+    static void histogram (uint64_t ndat,
+                           const unsigned char* from, unsigned nskip,
+                           unsigned long* hist, unsigned char flip = 0);
+
+  protected:
+
+    //! The instruction set in use
+    static Instructions instructions;
+
+    //! Set true when the instruction set has been chosen
+    static bool instructions_chosen;
+
+  };
+
+}
+
+#endif // !defined(__dsp_UnpackKernel_h)
@@ -39,6 +39,16 @@ namespace dsp
 
       unsigned get_bytes_per_row() { return bytes_per_row; }
 
+      //! Read rows with pread at offsets computed from the table layout
+      /*! When false, or when the layout cannot be resolved, each row is
+        read through cfitsio.  Enabled by default. */
+      void set_direct_read (bool flag) { direct_read = flag; }
+      bool get_direct_read () const { return direct_read; }
+
+      //! Set the number of rows to prefetch ahead of the current row
+      void set_prefetch_rows (unsigned nrow) { prefetch_rows = nrow; }
+      unsigned get_prefetch_rows () const { return prefetch_rows; }
+
 
     protected:
       friend class FITSUnpacker;
@@ -57,6 +67,20 @@ namespace dsp
 
       void set_bytes_per_row(const unsigned bytes) { bytes_per_row = bytes; }
 
+      //! Resolve the byte offsets of the DATA, DAT_SCL and DAT_OFFS columns
+      void resolve_layout ();
+
+      //! Read part of a row and its scales and offsets through cfitsio
+      void read_row_cfitsio (unsigned row, unsigned offset,
+                             unsigned nbyte, unsigned char* buffer);
+
+      //! Read part of a row and its scales and offsets with pread
+      void read_row_direct (unsigned row, unsigned offset,
+                            unsigned nbyte, unsigned char* buffer);
+
+      //! Advise the kernel that the following rows will be read soon
+      void prefetch (unsigned row);
+
       void set_data_colnum(const int colnum) { data_colnum = colnum; }
 
       int get_data_colnum() const { return data_colnum; }
@@ -95,6 +119,26 @@ namespace dsp
       //! Offset to conver unsigned integers to signed integers
       float zero_off;
 
+      //! Read rows directly from the file descriptor
+      bool direct_read;
+
+      //! Number of rows prefetched ahead of the current row
+      unsigned prefetch_rows;
+
+      //! Last row for which prefetch was requested
+      unsigned prefetched_row;
+
+      //! Byte offset of the first row of the SUBINT table in the file
+      uint64_t table_start;
+
+      //! Number of bytes in each row of the SUBINT table (NAXIS1)
+      uint64_t row_length;
+
+      //! Byte offsets of the DATA, DAT_SCL and DAT_OFFS columns in a row
+      uint64_t data_offset;
+      uint64_t scl_offset;
+      uint64_t offs_offset;
+
       //! Store reference spectrum
       std::vector<float> dat_scl;
 
@@ -26,6 +26,11 @@
 #include "dsp/OutputFile.h"
 #include <fitsio.h>
 
+#include <pthread.h>
+#include <deque>
+
+class ThreadContext;
+
 namespace dsp {
 
   class FITSDigitizer;
@@ -60,6 +65,12 @@ namespace dsp {
     //! Set length of output file (seconds)
     void set_max_length( double );
 
+    //! Set the number of rows written by each call to cfitsio (0 = auto)
+    void set_batch_nrow ( unsigned );
+
+    //! Write each batch of rows in a background thread
+    void set_asynchronous ( bool );
+
   protected:
 
     //! Need a custom implementation of operation to handle FITS I/O
@@ -77,8 +88,11 @@ namespace dsp {
     //! Write nbyte bytes with cfitsio
     virtual int64_t unload_bytes (const void* buffer, uint64_t bytes);
 
-    //! Interface to CFITSIO with error checking and bookkeeping
-    unsigned char* write_bytes (int colnum, int isub, int offset, unsigned bytes_to_write, unsigned char** buffer);
+    //! Rows of DATA and ancillary columns assembled for output
+    class Batch;
+
+    //! Write a batch of complete (or the final partial) rows
+    void write_batch (Batch*);
 
     //! samples per block (FITS row)
     unsigned nsblk;
@@ -133,8 +147,59 @@ namespace dsp {
     //! set up buffers, etc.
     void initialize ();
 
-    //! helper method for FITS output
-    void write_row ();
+    //! Begin a new row with the current ancillary data
+    void begin_row ();
+
+    //! Return an empty batch, waiting for the writer if necessary
+    Batch* get_batch ();
+
+    //! Write the batch, or pass it to the writer thread
+    void submit (Batch*);
+
+    //! Submit any partial batch and wait until all batches are written
+    void flush ();
+
+    //! Stop and join the writer thread
+    void stop_writer ();
+
+    //! The writer thread
+    static void* writer (void*);
+
+    //! Throw the first error raised by the writer thread, if any
+    void check_writer ();
+
+    //! The batch currently being filled
+    Batch* current;
+
+    //! Batches waiting to be written
+    std::deque<Batch*> full_batches;
+
+    //! Batches available for filling
+    std::vector<Batch*> free_batches;
+
+    //! Total number of batches allocated
+    unsigned nbatch;
+
+    //! Number of rows in each batch
+    unsigned batch_nrow;
+
+    //! Number of rows requested by set_batch_nrow
+    unsigned requested_batch_nrow;
+
+    //! Write batches in a background thread
+    bool asynchronous;
+
+    //! Protects the batch queues and writer state
+    ThreadContext* context;
+
+    //! The writer thread
+    pthread_t writer_id;
+
+    //! Writer thread state
+    bool writer_running;
+    bool writer_stop;
+    bool writer_failed;
+    Error writer_error;
 
     //! Use ATNF datestr convention
     bool use_atnf;
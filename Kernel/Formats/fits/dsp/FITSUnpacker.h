@@ -41,6 +41,16 @@ namespace dsp
 
       float eightBitNumber(const int num);
 
+      //! Decode every possible byte into samples_per_byte values
+      void build_lookup (unsigned nbit);
+
+      //! Decoded values, indexed by byte value and position in the byte
+      std::vector<float> lookup;
+
+      //! The nbit and zero offset used to build the lookup table
+      unsigned lookup_nbit;
+      float lookup_zero_off;
+
       float zero_off;
 
       std::vector<float> dat_scl;
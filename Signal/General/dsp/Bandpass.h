@@ -54,6 +54,9 @@ namespace dsp {
     //! Set the integration length and bandpass to zero
     void reset_output();
 
+    //! Add the integrated bandpass of another Bandpass instance
+    void combine (const Operation*);
+
   protected:
     
     //! Perform the transformation on the input time series
@@ -0,0 +1,123 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/BatchedFFT.h
+
+#ifndef __BatchedFFT_h
+#define __BatchedFFT_h
+
+#include "ReferenceAble.h"
+#include "FTransform.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Many FFTs of the same length computed at once
+  /*! The input contains the ndat points of each of nbatch transforms,
+    with the nbatch values of each point contiguous.  Each butterfly of
+    the radix-2 Stockham algorithm operates on all transforms in a loop
+    that is vectorized by the compiler, and the result is in natural
+    order without bit reversal.  The length must be a power of two.
+
+    The forward transforms of real data are computed as complex
+    transforms of half the length, in which each pair of consecutive
+    real samples is a complex point, followed by a step that separates
+    the spectra of the even and odd samples.
+
+    The normalization of the FFT library plan is measured during setup
+    and returned by get_scale; the caller applies it when copying the
+    result, which is unscaled. */
+  class BatchedFFT : public Reference::Able
+  {
+  public:
+
+    //! When the batched FFT is used in place of the FFT library
+    enum Policy
+    {
+      //! When it is faster than the FFT library
+      Benchmark,
+      //! Whenever the length of the transform is a power of two
+      Always,
+      //! Never; the FFT library computes each transform
+      Never
+    };
+
+    //! Return true if transforms of length ndat are supported
+    static bool supported (unsigned ndat);
+
+    //! Default constructor
+    BatchedFFT ();
+
+    //! Prepare nbatch forward or backward transforms of length ndat
+    /*! The plan must compute complex-to-complex transforms of length
+      ndat in the same direction; it is used to match normalization
+      and by benchmark. */
+    void setup (FTransform::Plan* plan, unsigned ndat, unsigned nbatch,
+                bool forward);
+
+    //! Prepare nbatch forward transforms of ndat real samples
+    /*! The plan must compute real-to-complex transforms of length ndat;
+      each transform yields ndat/2+1 complex points. */
+    void setup_real (FTransform::Plan* plan, unsigned ndat, unsigned nbatch);
+
+    //! Get the length of each transform
+    unsigned get_ndat () const { return ndat; }
+
+    //! Return true if the input is real
+    bool get_real () const { return real; }
+
+    //! Get the number of transforms
+    unsigned get_nbatch () const { return nbatch; }
+
+    //! Get the scale that matches the normalization of the FFT library
+    float get_scale () const { return scale; }
+
+    //! Return the input of the next transform
+    /*! In the real-to-complex case, the ndat real samples of each
+      transform are stored as ndat/2 complex points. */
+    float* get_input () { return &(work[0]); }
+
+    //! Compute the transforms of the input; return the unscaled result
+    /*! The input is overwritten; the result is valid until the next
+      call to transform. */
+    const float* transform ();
+
+    //! Return true if the batched FFT is faster than the FFT library
+    bool benchmark ();
+
+  protected:
+
+    //! Compute the twiddle factors and allocate work space
+    void prepare (unsigned npt);
+
+    //! The FFT library plan
+    FTransform::Plan* plan;
+
+    unsigned ndat;
+    unsigned nbatch;
+    bool forward;
+    bool real;
+    float scale;
+
+    //! Twiddle factors
+    std::vector<float> twiddle;
+
+    //! Twiddle factors of the step that separates even and odd samples
+    std::vector<float> split;
+
+    //! Input and work space of the Stockham algorithm
+    std::vector<float> work;
+
+    //! Result of the real-to-complex transforms
+    std::vector<float> result;
+  };
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/BlockSizeTuner.h
+
+#ifndef __dsp_BlockSizeTuner_h
+#define __dsp_BlockSizeTuner_h
+
+#include "ReferenceAble.h"
+#include "environ.h"
+
+#include <string>
+#include <vector>
+
+namespace dsp {
+
+  //! Chooses the Input block size that maximizes processing throughput
+  /*! The tuner proposes a sequence of trial block sizes, each a multiple
+    of the minimum number of samples required by the pipeline and none
+    larger than the maximum allowed by the memory budget.  For each
+    trial, the caller processes a few blocks and reports the number of
+    samples consumed and the time spent in each block.  When every
+    trial has been timed, the block size with the lowest cost per
+    sample is chosen.
+
+    The choice is saved in a file alongside the FFT benchmark data,
+    indexed by a key that describes the data and the pipeline, so
+    that subsequent runs may use it without repeating the trials. */
+  class BlockSizeTuner : public Reference::Able
+  {
+  public:
+
+    //! Verbosity flag
+    static bool verbose;
+
+    //! Default constructor
+    BlockSizeTuner ();
+
+    //! Set the range of block sizes to be tested
+    /*! Trial block sizes are (minimum - overlap) * 2^n + overlap that
+      are multiples of resolution; the current block size is always tested */
+    void set_range (uint64_t minimum, uint64_t maximum, uint64_t overlap,
+                    unsigned resolution, uint64_t current_size);
+
+    //! Set the number of blocks timed for each trial block size
+    void set_blocks_per_trial (unsigned nblock) { blocks_per_trial = nblock; }
+
+    //! Set the number of blocks ignored after each change of block size
+    void set_warmup_blocks (unsigned nblock) { warmup_blocks = nblock; }
+
+    //! Set the key that identifies this configuration in the saved file
+    void set_key (const std::string&);
+
+    //! Set the name of the file in which choices are saved
+    void set_filename (const std::string& name) { filename = name; }
+
+    //! Load a previous choice for the current key; return true if found
+    bool load ();
+
+    //! Save the choice for the current key
+    void unload () const;
+
+    //! Return the block size to be used for the next block
+    uint64_t get_block_size () const;
+
+    //! Record the samples consumed and time spent processing one block
+    void add_block (uint64_t nsamples, double seconds);
+
+    //! Return true when the best block size has been chosen
+    bool get_done () const { return done; }
+
+    //! Return the number of trial block sizes
+    unsigned get_ntrial () const { return trial.size(); }
+
+    //! Return the cost per sample of the specified trial
+    double get_cost (unsigned itrial) const;
+
+  protected:
+
+    //! The trial block sizes
+    std::vector<uint64_t> trial;
+
+    //! Total time spent processing each trial block size
+    std::vector<double> seconds;
+
+    //! Total number of samples processed with each trial block size
+    std::vector<uint64_t> samples;
+
+    //! The current trial
+    unsigned current;
+
+    //! Number of blocks processed with the current trial block size
+    unsigned nblock;
+
+    unsigned blocks_per_trial;
+    unsigned warmup_blocks;
+
+    //! The chosen block size
+    uint64_t best;
+
+    //! Set when the best block size has been chosen
+    bool done;
+
+    std::string key;
+    std::string filename;
+
+    //! Choose the best trial block size and save it
+    void choose ();
+  };
+
+}
+
+#endif // !defined(__dsp_BlockSizeTuner_h)
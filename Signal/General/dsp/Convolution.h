@@ -99,6 +99,19 @@ namespace dsp {
     //! Return a pointer to the integrated passband
     virtual const Response* get_passband() const;
 
+    //! Return true if the apodization attribute has been set
+    bool has_apodization () const;
+
+    //! Return a pointer to the apodization function
+    const Apodization* get_apodization () const;
+
+    //! Return true if the response is a Jones matrix
+    bool get_matrix_convolution () const { return matrix_convolution; }
+
+    //! Return true if the specified input data order can be supported
+    bool get_order_supported (TimeSeries::Order order) const
+    { return order == TimeSeries::OrderFPT; }
+
     //! Set the memory allocator to be used
     void set_device (Memory *);
 
@@ -129,6 +142,8 @@ namespace dsp {
     friend class Filterbank;
     friend class TFPFilterbank;
     friend class SKFilterbank;
+    friend class MultiConvolution;
+    friend class PolyPhaseFilterbank;
 
     Reference::To<Memory> memory;
 
@@ -0,0 +1,93 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/Decimate.h
+
+#ifndef __dsp_Decimate_h
+#define __dsp_Decimate_h
+
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+
+namespace dsp {
+
+  class WeightedTimeSeries;
+
+  //! Decimates a detected TimeSeries in time, frequency and polarization
+  /*! Performs the combined operation of FScrunch, TScrunch and PScrunch
+    in a single pass over the data.  The samples are first summed over
+    the time dimension in cache-sized blocks with contiguous loops that
+    are vectorized by the compiler, then summed over frequency and
+    polarization; the result is identical to that of the separate
+    operations.
+
+    When the input is a WeightedTimeSeries, samples with zero weight
+    are excluded and each sum is renormalized by the number of samples
+    that contributed; sums to which no samples contributed are zero.
+
+    As for TScrunch, input data are buffered to handle block sizes
+    that are not integer multiples of the time decimation factor. */
+  class Decimate : public Transformation <TimeSeries, TimeSeries>
+  {
+
+  public:
+
+    //! Default constructor
+    Decimate (Behaviour place=anyplace);
+
+    //! Set the number of time samples summed into each output sample
+    void set_time_factor (unsigned factor) { time_factor = factor; }
+
+    //! Get the number of time samples summed into each output sample
+    unsigned get_time_factor () const { return time_factor; }
+
+    //! Set the number of channels summed into each output channel
+    void set_frequency_factor (unsigned factor) { frequency_factor = factor; }
+
+    //! Get the number of channels summed into each output channel
+    unsigned get_frequency_factor () const { return frequency_factor; }
+
+    //! Sum the first two polarizations, as done by PScrunch
+    void set_poln_scrunch (bool flag) { poln_scrunch = flag; }
+
+    //! Get the polarization scrunch flag
+    bool get_poln_scrunch () const { return poln_scrunch; }
+
+  protected:
+
+    //! Prepare input buffer
+    void prepare ();
+
+    //! Perform decimation
+    void transformation ();
+
+    //! Decimate data in FPT order
+    void fpt_decimate ();
+
+    //! Decimate data in TFP order
+    void tfp_decimate ();
+
+    //! Return the weights of the specified input channel and polarization
+    const unsigned* get_weights (unsigned ichan, unsigned ipol) const;
+
+    unsigned time_factor;
+    unsigned frequency_factor;
+    bool poln_scrunch;
+
+    //! Attributes of the current block
+    uint64_t output_ndat;
+    unsigned output_nchan;
+    unsigned output_npol;
+
+    //! The weighted input, if any
+    const WeightedTimeSeries* weighted_input;
+  };
+
+}
+
+#endif // !defined(__dsp_Decimate_h)
@@ -137,6 +137,12 @@ namespace dsp {
     //! Build delays in microseconds instead of phases
     void set_build_delays (bool delay = true);
 
+    //! Return true if a change of DM or Doppler shift is pending
+    /*! When only the dispersion measure or Doppler shift have changed
+      since the last build, the next match scales the phases of the
+      existing kernel instead of building a new one. */
+    bool get_rephase () const { return rephase; }
+
     class SampleDelay;
 
     //!
@@ -180,6 +186,27 @@ namespace dsp {
     //! Flag that the response and bandpass attributes reflect the state
     bool built;
 
+    //! Flag set when only the dispersion measure or Doppler shift changed
+    bool rephase;
+
+    //! The phases computed by the last build, in natural order
+    /*! Without fractional delay compensation, the phases are
+      proportional to the product of the dispersion measure and
+      Doppler shift, and can be scaled to a new value of either. */
+    std::vector<float> built_phases;
+
+    //! Dispersion measure times Doppler shift of built_phases
+    double built_dispersion;
+
+    //! Doppler shift of frequency_output and bandwidth_output
+    double output_Doppler_shift;
+
+    //! Record a change of dispersion measure or Doppler shift
+    void set_rephase ();
+
+    //! Scale the phases of the last build to the current DM and Doppler shift
+    void update_phases ();
+
     //! Supported frequency channels
     /*! Set to false when the dispersive smearing is too large */
     std::vector<bool> supported_channels;
@@ -28,6 +28,11 @@ namespace dsp {
     double get_centre_frequency ( ) const;
     double get_bandwidth (  ) const;
 
+    //! Select the isub'th of nsub equal divisions of the channels
+    /*! Overrides the centre frequency and bandwidth; the number of
+      input channels must be divisible by nsub. */
+    void set_subband (unsigned isub, unsigned nsub);
+
     //! Given an input and a goal freq / bandwidth, select channel bounds
     static void set_channel_bounds(const Observation* input,
         double centre_frequency, double bandwidth,
@@ -51,6 +56,9 @@ namespace dsp {
     double centre_frequency;
     double bandwidth;
 
+    //! The selected division of the channels (if nsubband > 0)
+    unsigned isubband, nsubband;
+
     unsigned chan_lo,chan_hi;
     void fpt_copy(TimeSeries* dest);
     void tfp_copy(TimeSeries* dest);
@@ -12,6 +12,7 @@
 #define __FilterbankConfig_h
 
 #include "dsp/Filterbank.h"
+#include "dsp/Apodization.h"
 
 namespace dsp
 {
@@ -39,6 +40,18 @@ namespace dsp
     void set_convolve_when (When w) { when = w; }
     When get_convolve_when () const { return when; }
 
+    //! Use a polyphase filterbank with ntap taps (0 = disabled)
+    void set_ntap (unsigned n) { ntap = n; }
+    unsigned get_ntap () const { return ntap; }
+
+    //! Set the window applied to the polyphase prototype filter
+    void set_window (Apodization::Type w) { window = w; }
+    Apodization::Type get_window () const { return window; }
+
+    //! Batch the FFTs on the CPU when faster than the FFT library
+    void set_batched (bool flag) { batched = flag; }
+    bool get_batched () const { return batched; }
+
     //! Set the device on which the unpacker will operate
     void set_device (Memory*);
 
@@ -55,6 +68,9 @@ namespace dsp
     unsigned nchan;
     unsigned freq_res;
     When when;
+    unsigned ntap;
+    Apodization::Type window;
+    bool batched;
 
   };
 
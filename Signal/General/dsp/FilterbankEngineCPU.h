@@ -0,0 +1,113 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/FilterbankEngineCPU.h
+
+#ifndef __FilterbankEngineCPU_h
+#define __FilterbankEngineCPU_h
+
+#include "dsp/FilterbankEngine.h"
+#include "dsp/BatchedFFT.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Filterbank step on the CPU with batched backward FFTs
+  /*! Performs the same operations as Filterbank::filterbank; however,
+    when the frequency resolution is a power of two, the backward FFTs
+    of all nchan_subband channels in each part may be computed as a
+    single BatchedFFT.  The spectrum is transposed so that the channels
+    of each point are contiguous, and the valid points of each channel
+    are then copied directly to the output.
+
+    By default, the batched transform is used only if it is faster
+    than the backward FFT of each channel computed by the FFT library,
+    as measured during setup.  As in Filterbank, the FFT library is
+    chosen by the OptimalFFT of the response, if any.
+
+    This engine is used only when requested; see
+    Filterbank::Config::set_batched. */
+  class FilterbankEngineCPU : public Filterbank::Engine
+  {
+  public:
+
+    //! Default constructor
+    FilterbankEngineCPU ();
+
+    //! Set when the batched backward FFT is used
+    void set_batch (BatchedFFT::Policy b) { batch = b; }
+
+    //! Get when the batched backward FFT is used
+    BatchedFFT::Policy get_batch () const { return batch; }
+
+    //! Return true if the batched backward FFT was chosen during setup
+    bool get_batched () const { return batched; }
+
+    //! Prepare plans and work space
+    void setup (Filterbank*);
+
+    //! Work space is allocated by the engine
+    void set_scratch (float*) { }
+
+    //! Perform the filterbank operation on the input data
+    void perform (const TimeSeries* in, TimeSeries* out,
+                  uint64_t npart, const uint64_t in_step,
+                  const uint64_t out_step);
+
+  protected:
+
+    //! Compute the batched backward FFTs of one spectrum in the work space
+    const float* batched_transform (const float* spectrum);
+
+    //! Compute the backward FFTs of one spectrum and copy to the output
+    void backward_batched (const float* spectrum, TimeSeries* out,
+                           unsigned jchan, unsigned ipol, uint64_t out_offset);
+
+    //! Compute the backward FFTs one channel at a time
+    void backward_each (const float* spectrum, TimeSeries* out,
+                        unsigned jchan, unsigned ipol, uint64_t out_offset);
+
+    //! The convolution kernel, if any
+    const Response* response;
+
+    //! The passband integrator, if any
+    Response* passband;
+
+    //! The time-domain window, if any
+    const Apodization* apodization;
+
+    FTransform::Plan* forward;
+    FTransform::Plan* backward;
+
+    BatchedFFT::Policy batch;
+
+    bool real_to_complex;
+    bool matrix_convolution;
+    bool batched;
+
+    unsigned nchan_subband;
+    unsigned freq_res;
+    unsigned nfilt_pos;
+    unsigned nkeep;
+    uint64_t nsamp_fft;
+
+    //! The batched backward FFT, if used
+    Reference::To<BatchedFFT> batched_fft;
+
+    //! Spectra of each polarization
+    std::vector<float> spectrum[2];
+
+    //! Work space for the library transform and windowed input
+    std::vector<float> work;
+    std::vector<float> windowed;
+  };
+
+}
+
+#endif
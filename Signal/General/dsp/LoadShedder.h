@@ -0,0 +1,145 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/LoadShedder.h
+
+#ifndef __dsp_LoadShedder_h
+#define __dsp_LoadShedder_h
+
+#include "dsp/LoadSheddingHistory.h"
+#include "Reference.h"
+
+#include <iostream>
+#include <vector>
+
+namespace dsp {
+
+  class Operation;
+
+  //! Degrades optional stages of a pipeline that falls behind real time
+  /*! Optional stages are added in order of priority: the first stage
+    added is the first to be shed.  After each block, update is called
+    with the lag measured by the RealTimeMonitor.  When the lag exceeds
+    a fraction of the input buffer, the next optional stage is shed;
+    when the lag falls below a smaller fraction of the buffer, the most
+    recently shed stage is restored.  At most one change is made per
+    holdoff interval, so that the effect of each change on the lag can
+    be measured before the next.
+
+    Each change is recorded in a LoadSheddingHistory, which may be
+    added to the Extensions of the output so that the degradation is
+    recorded with the data products. */
+  class LoadShedder : public Reference::Able
+  {
+  public:
+
+    //! An optional stage of the pipeline that may be degraded
+    class Stage : public Reference::Able
+    {
+    public:
+
+      //! Construct with the name recorded in the history
+      Stage (const std::string& _name) : name (_name) { }
+
+      //! Degrade the stage
+      virtual void shed () = 0;
+
+      //! Restore the stage
+      virtual void restore () = 0;
+
+      //! Return true if the Operation is skipped while the stage is shed
+      virtual bool skips (const Operation*) const { return false; }
+
+      //! Get the name recorded in the history
+      const std::string& get_name () const { return name; }
+
+    protected:
+
+      std::string name;
+    };
+
+    //! A stage that is shed by skipping one or more Operations
+    class Skip : public Stage
+    {
+    public:
+
+      //! Construct with the name recorded in the history
+      Skip (const std::string& name) : Stage (name) { skipping = false; }
+
+      //! Add an Operation to be skipped
+      void add (Operation* op) { operations.push_back (op); }
+
+      void shed () { skipping = true; }
+      void restore () { skipping = false; }
+      bool skips (const Operation*) const;
+
+    protected:
+
+      std::vector< Reference::To<Operation> > operations;
+      bool skipping;
+    };
+
+    //! Default constructor
+    LoadShedder ();
+
+    //! Add an optional stage; stages are shed in the order added
+    void add_stage (Stage*);
+
+    //! Get the number of optional stages
+    unsigned get_nstage () const { return stages.size(); }
+
+    //! Get the number of stages currently shed
+    unsigned get_nshed () const { return nshed; }
+
+    //! Set the fraction of the buffer at which a stage is shed
+    void set_shed_fraction (double fraction) { shed_fraction = fraction; }
+
+    //! Set the fraction of the buffer below which a stage is restored
+    void set_restore_fraction (double fraction) { restore_fraction = fraction; }
+
+    //! Set the minimum wall time in seconds between changes
+    void set_holdoff (double seconds) { holdoff = seconds; }
+
+    //! Set the stream to which changes are reported (null to disable)
+    void set_log (std::ostream* os) { log = os; }
+
+    //! Shed or restore a stage; return true if a change was made
+    /*! \param lag the current lag behind real time in seconds
+      \param buffer the duration of the input buffer in seconds
+      \param epoch the epoch of the data at which the change is made */
+    bool update (double lag, double buffer, const MJD& epoch);
+
+    //! Return true if the Operation should be skipped
+    bool skip (const Operation*) const;
+
+    //! Get the record of changes
+    LoadSheddingHistory* get_history () { return history; }
+
+  protected:
+
+    //! The optional stages, in order of priority
+    std::vector< Reference::To<Stage> > stages;
+
+    //! The number of stages currently shed
+    unsigned nshed;
+
+    double shed_fraction;
+    double restore_fraction;
+    double holdoff;
+
+    //! Wall time of the last change
+    double last_change;
+
+    std::ostream* log;
+
+    Reference::To<LoadSheddingHistory> history;
+  };
+
+}
+
+#endif // !defined(__dsp_LoadShedder_h)
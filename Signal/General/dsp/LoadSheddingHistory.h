@@ -0,0 +1,59 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/LoadSheddingHistory.h
+
+#ifndef __dsp_LoadSheddingHistory_h
+#define __dsp_LoadSheddingHistory_h
+
+#include "dsp/dspExtension.h"
+#include "MJD.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Records when optional stages were degraded by the LoadShedder
+  class LoadSheddingHistory : public dspExtension
+  {
+  public:
+
+    //! Default constructor
+    LoadSheddingHistory ();
+
+    //! Return a new copy-constructed instance identical to this instance
+    dspExtension* clone () const;
+
+    //! Record that a stage was shed (or restored) at the specified epoch
+    void add (const MJD& epoch, const std::string& stage, bool shed);
+
+    //! Return the number of recorded changes
+    unsigned get_nchange () const { return changes.size(); }
+
+    //! Return a summary of the changes that affect the specified interval
+    /*! The summary lists the stages that were shed at the start of the
+      interval and the changes made during the interval; it is empty
+      if all stages were enabled throughout the interval. */
+    std::string get_summary (const MJD& start, const MJD& end) const;
+
+  protected:
+
+    struct Change
+    {
+      MJD epoch;
+      std::string stage;
+      bool shed;
+    };
+
+    //! The changes, in order of epoch
+    std::vector<Change> changes;
+  };
+
+}
+
+#endif // !defined(__dsp_LoadSheddingHistory_h)
@@ -41,7 +41,20 @@ namespace dsp {
     //! Final preparations before running
     void prepare ();
 
-  private:
+  protected:
+
+    //! Append the operations that write a time series to a file
+    void construct_output (TimeSeries*, const std::string& filename,
+                           bool do_pscrunch);
+
+    //! Return the channels to be detected and written by this thread
+    /*! By default, all channels are processed; LoadToFilMPI divides
+      the band between processes. */
+    virtual TimeSeries* select_band (TimeSeries* data) { return data; }
+
+    //! Return the digitized data to be written by this thread
+    /*! Returns null if this thread writes no output */
+    virtual BitSeries* gather_output (BitSeries* data) { return data; }
 
     friend class LoadToFilN;
 
@@ -54,8 +67,8 @@ namespace dsp {
     //! The dedispersion kernel
     Reference::To<Dedispersion> kernel;
 
-    //! The output file
-    Reference::To<OutputFile> outputFile;
+    //! The output files, one for each trial DM
+    std::vector< Reference::To<OutputFile> > outputFiles;
 
     //! Verbose output
     static bool verbose;
@@ -85,6 +98,12 @@ namespace dsp {
     //! removed inter-channel dispersion delays
     bool dedisperse;
 
+    //! trial dispersion measures, each written to a separate file
+    std::vector<double> dm_trials;
+
+    //! number of subbands used to dedisperse the trials (0 = automatic)
+    unsigned dm_nsubband;
+
     //! coherently dedisperse along with filterbank
     bool coherent_dedisp;
 
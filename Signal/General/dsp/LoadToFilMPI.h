@@ -0,0 +1,87 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/LoadToFilMPI.h
+
+#ifndef __dspsr_LoadToFilMPI_h
+#define __dspsr_LoadToFilMPI_h
+
+#include <mpi.h>
+
+#include "dsp/LoadToFil.h"
+
+namespace dsp {
+
+  class MPIChannelGather;
+
+  //! Divides the band of one observation between MPI processes
+  /*! Each process in the communicator reads the entire observation
+    and forms the filterbank, if any, e.g. with
+
+    mpirun -np 4 digifil -F 1024 -o out.fil ...
+
+    After the filterbank and the removal of inter-channel delays, each
+    process selects an equal share of the channels (see FZoom) and
+    detects, scrunches, rescales and digitizes only those channels.
+    The digitized channels of all processes are gathered by the root
+    process (see MPIChannelGather), which writes a single file equal
+    to that written by a single process.
+
+    The number of channels must be divisible by the number of
+    processes, and each share must be a whole number of bytes in each
+    output sample.  Trial DMs, which sum over the band, are not
+    supported. */
+  class LoadToFilMPI : public LoadToFil
+  {
+
+  public:
+
+    //! Constructor
+    LoadToFilMPI (Config* config, MPI_Comm comm);
+
+    //! Get the number of processes in the communicator
+    int get_size () const { return mpi_size; }
+
+    //! Get the rank of this process within the communicator
+    int get_rank () const { return mpi_rank; }
+
+    //! Get the rank of the process that writes the output
+    int get_root () const { return mpi_root; }
+    //! Set the rank of the process that writes the output
+    void set_root (int root);
+
+    //! Create the pipeline
+    void construct ();
+
+  protected:
+
+    //! Select the share of the channels processed by this process
+    TimeSeries* select_band (TimeSeries* data);
+
+    //! Gather the digitized channels on the root process
+    BitSeries* gather_output (BitSeries* data);
+
+    //! The band before it is divided between processes
+    Reference::To<TimeSeries> band;
+
+    //! The communicator
+    MPI_Comm mpi_comm;
+
+    //! The number of processes in the communicator
+    int mpi_size;
+
+    //! The rank of this process
+    int mpi_rank;
+
+    //! The rank of the process that writes the output
+    int mpi_root;
+  };
+
+}
+
+#endif // !defined(__dspsr_LoadToFilMPI_h)
@@ -45,8 +45,8 @@ namespace dsp {
     /*! call to set_configuration may precede set_nthread */
     Reference::To<LoadToFil::Config> configuration;
 
-    //! OutputFile sharing
-    Reference::To<OutputFileShare> output_file;
+    //! OutputFile sharing, one for each output file
+    std::vector< Reference::To<OutputFileShare> > output_file;
 
     //! The creator of new LoadToFil threads
     virtual LoadToFil* new_thread ();
@@ -0,0 +1,143 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/LoadToStats.h
+
+#ifndef __dspsr_LoadToStats_h
+#define __dspsr_LoadToStats_h
+
+#include "dsp/SingleThread.h"
+#include "dsp/TimeSeries.h"
+#include "dsp/SampleStatistics.h"
+#include "dsp/Bandpass.h"
+
+#include <fstream>
+
+namespace dsp {
+
+  //! Computes digitizer and channel statistics in a single pass
+  /*! Each block of data is loaded once and used to update the
+    histograms of the digitized states (maintained by the HistUnpacker),
+    the first four moments of each channel and polarization, and the
+    integrated bandpass.  When run by LoadToStatsN, each thread
+    accumulates the statistics of the blocks that it processes, and
+    the results of all threads are combined before the report is
+    written by finish.
+
+    When Config::interval is set, a single thread reports and resets
+    the statistics at the end of the first block that completes each
+    interval; digihist is built on this mode. */
+  class LoadToStats : public SingleThread
+  {
+
+  public:
+
+    //! Configuration parameters
+    class Config;
+
+    //! Set the configuration to be used in prepare and run
+    void set_configuration (Config*);
+
+    //! Constructor
+    LoadToStats (Config* config = 0);
+
+    //! Create the pipeline
+    void construct ();
+
+    //! Write the report
+    void finish ();
+
+  protected:
+
+    //! Report the statistics of each interval
+    void end_of_block ();
+
+  private:
+
+    friend class LoadToStatsN;
+
+    //! Configuration parameters
+    Reference::To<Config> config;
+
+    //! The moments of each channel and polarization
+    Reference::To<SampleStatistics> moments;
+
+    //! The integrated bandpass
+    Reference::To<Bandpass> bandpass;
+
+    //! Write the report to the stream
+    void report (std::ostream&);
+
+    //! Write the description of the observation to the stream
+    void report_header (std::ostream&);
+
+    //! Write the report of the current interval and reset the statistics
+    void report_interval (double end);
+
+    //! Return the stream to which the report is written
+    std::ostream& get_output ();
+
+    //! The output file, when Config::output_filename is set
+    std::ofstream output_file;
+
+    //! True when the header has been written
+    bool header_written;
+
+    //! The start of the current interval (seconds after the start time)
+    double interval_start;
+
+    //! Return the time elapsed at the end of the last block, in seconds
+    double get_elapsed () const;
+
+    //! Verbose output
+    static bool verbose;
+
+  };
+
+  //! Load, unpack and compute the statistics of the data
+  class LoadToStats::Config : public SingleThread::Config
+  {
+  public:
+
+    // Sets default values
+    Config ();
+
+    //! input data block size in MB
+    double block_size;
+
+    //! report the histograms of the digitized states
+    bool histograms;
+
+    //! report the moments of each channel and polarization
+    bool moments;
+
+    //! number of frequency channels in the bandpass (0 to disable)
+    unsigned bandpass_nchan;
+
+    //! detected state of the bandpass (PPQQ or Intensity)
+    Signal::State bandpass_state;
+
+    //! name of the output file (standard output if empty)
+    std::string output_filename;
+
+    //! length of each reported interval in seconds (0 for the whole file)
+    double interval;
+
+    //! Set quiet mode
+    virtual void set_quiet ();
+
+    //! Set verbose
+    virtual void set_verbose();
+
+    //! Set very verbose
+    virtual void set_very_verbose();
+
+  };
+}
+
+#endif // !defined(__LoadToStats_h)
@@ -0,0 +1,51 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/LoadToStatsN.h
+
+#ifndef __dspsr_LoadToStatsN_h
+#define __dspsr_LoadToStatsN_h
+
+#include "dsp/LoadToStats.h"
+#include "dsp/MultiThread.h"
+
+namespace dsp {
+
+  //! Multiple LoadToStats threads
+  /*! Each thread loads and processes different blocks of the shared
+    Input; their statistics are combined by MultiThread::finish. */
+  class LoadToStatsN : public MultiThread
+  {
+
+  public:
+
+    //! Constructor
+    LoadToStatsN (LoadToStats::Config*);
+
+    //! Set the number of thread to be used
+    void set_nthread (unsigned);
+
+    //! Set the configuration to be used in prepare and run
+    void set_configuration (LoadToStats::Config*);
+
+  protected:
+
+    //! Configuration parameters
+    /*! call to set_configuration may precede set_nthread */
+    Reference::To<LoadToStats::Config> configuration;
+
+    //! The creator of new LoadToStats threads
+    virtual LoadToStats* new_thread ();
+
+    LoadToStats* at (unsigned index);
+
+  };
+
+}
+
+#endif // !defined(__LoadToStatsN_h)
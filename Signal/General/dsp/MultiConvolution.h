@@ -0,0 +1,94 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/MultiConvolution.h
+
+#ifndef __dsp_MultiConvolution_h
+#define __dsp_MultiConvolution_h
+
+#include "dsp/Convolution.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Convolves a TimeSeries with several frequency response functions
+  /*! The forward FFT of each segment of the input TimeSeries is
+    computed only once; the spectrum is then multiplied by each of the
+    additional response functions and inverse transformed into the
+    corresponding output TimeSeries.  The primary response (set with
+    Convolution::set_response) produces Convolution::output, as usual.
+
+    This is useful when searching a range of trial dispersion measures,
+    where the cost of the forward FFT would otherwise be repeated for
+    each trial.  All response functions must have the same number of
+    frequency channels, frequency resolution and impulse response
+    duration; Dedispersion kernels are adjusted to the largest of
+    each before the first transformation.  Only scalar (non-matrix)
+    response functions are supported, and the alternate processing
+    engine (e.g. GPU) is not. */
+
+  class MultiConvolution: public Convolution {
+
+  public:
+
+    //! Default constructor
+    MultiConvolution ();
+
+    //! Add a response function and the TimeSeries into which it is output
+    void add_response (Response* response, TimeSeries* output);
+
+    //! Get the number of additional response functions
+    unsigned get_nresponse () const { return responses.size(); }
+
+    using Convolution::get_response;
+
+    //! Get the specified additional response function
+    const Response* get_response (unsigned iresponse) const;
+
+    using Convolution::get_output;
+
+    //! Get the output of the specified additional response function
+    TimeSeries* get_output (unsigned iresponse);
+
+    //! Enable or disable the specified additional response function
+    /*! While disabled, the response is not applied and its output is
+      resized to zero samples. */
+    void set_enabled (unsigned iresponse, bool enabled);
+
+    //! Return true if the specified additional response is enabled
+    bool get_enabled (unsigned iresponse) const;
+
+    //! Prepare all relevant attributes
+    void prepare ();
+
+    //! Reserve the maximum amount of output space required
+    void reserve ();
+
+  protected:
+
+    //! Perform the convolution transformation on the input TimeSeries
+    virtual void transformation ();
+
+    //! Match all response functions to the input and to each other
+    void match_responses ();
+
+    //! The additional response functions
+    std::vector< Reference::To<Response> > responses;
+
+    //! The output of each additional response function
+    std::vector< Reference::To<TimeSeries> > outputs;
+
+    //! Flags set when each additional response function is applied
+    std::vector<bool> enabled;
+
+  };
+
+}
+
+#endif // !defined(__dsp_MultiConvolution_h)
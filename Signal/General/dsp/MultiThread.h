@@ -56,9 +56,18 @@ namespace dsp {
     //! Finish everything
     void finish ();
 
+    //! Stop reading data in all threads after their current blocks
+    void stop ();
+
     //! Get the minimum number of samples required to process
     uint64_t get_minimum_samples () const;
 
+    //! Get the number of threads
+    unsigned get_nthread () const { return threads.size(); }
+
+    //! Get the specified thread
+    SingleThread* get_thread (unsigned ithread);
+
   protected:
 
     //! Input
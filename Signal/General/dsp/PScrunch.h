@@ -30,6 +30,10 @@ namespace dsp
     //! PScrunch to zero mean and unit variance
     void transformation ();
 
+    //! Return true if the specified input data order can be supported
+    bool get_order_supported (TimeSeries::Order order) const
+    { return order == TimeSeries::OrderFPT || order == TimeSeries::OrderTFP; }
+
    class Engine;
 
    void set_engine (Engine*);
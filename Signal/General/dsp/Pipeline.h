@@ -43,6 +43,11 @@ namespace dsp {
     //! Finish everything
     virtual void finish () = 0;
 
+    //! Stop reading data after the block currently being processed
+    /*! May be called from another thread while run is in progress;
+      run returns as though the end of data had been reached. */
+    virtual void stop () = 0;
+
     //! Get the minimum number of samples required to process
     virtual uint64_t get_minimum_samples () const = 0;
 
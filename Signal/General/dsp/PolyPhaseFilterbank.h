@@ -0,0 +1,126 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/PolyPhaseFilterbank.h
+
+#ifndef __PolyPhaseFilterbank_h
+#define __PolyPhaseFilterbank_h
+
+#include "dsp/Filterbank.h"
+#include "dsp/Apodization.h"
+#include "dsp/BatchedFFT.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Breaks a single-band TimeSeries into multiple frequency channels
+  /*! This class implements a critically sampled polyphase filterbank.
+    Each block of nchan complex (or 2*nchan real) input samples is
+    formed from the weighted sum of ntap consecutive blocks, where the
+    weights are given by a windowed sinc prototype filter; the Fourier
+    transform of the weighted sum yields one sample in each of the
+    output channels.  Compared with the FFT-based Filterbank, the
+    prototype filter greatly reduces scalloping and spectral leakage
+    between neighbouring channels.
+
+    The tap history is carried from one block of data to the next by
+    the InputBuffering policy.  Convolution with a Response during the
+    filterbank and frequency resolution greater than one are not
+    supported; if required, coherent dedispersion may be performed by
+    a Convolution after the filterbank.
+
+    When requested and the number of channels is a power of two, the
+    FFTs of many consecutive output samples are computed together by a
+    BatchedFFT; the weighted sum of each output sample is stored as one
+    column of its input, and each channel of the result is a contiguous
+    series of output samples. */
+
+  class PolyPhaseFilterbank: public Filterbank {
+
+  public:
+
+    //! Default constructor
+    PolyPhaseFilterbank ();
+
+    //! Set the number of taps in each polyphase branch
+    void set_ntap (unsigned _ntap) { ntap = _ntap; }
+
+    //! Get the number of taps in each polyphase branch
+    unsigned get_ntap () const { return ntap; }
+
+    //! Set the window applied to the sinc prototype filter
+    void set_window (Apodization::Type type) { window = type; }
+
+    //! Get the window applied to the sinc prototype filter
+    Apodization::Type get_window () const { return window; }
+
+    //! Set when the FFTs of consecutive output samples are batched
+    void set_batch (BatchedFFT::Policy b) { batch = b; }
+
+    //! Get when the FFTs of consecutive output samples are batched
+    BatchedFFT::Policy get_batch () const { return batch; }
+
+    //! Return true if the batched FFT was chosen during prepare
+    bool get_batched () const { return batched; }
+
+    //! Set the order of the dimensions in the output TimeSeries
+    void set_output_order (TimeSeries::Order order) { output_order = order; }
+
+    //! Prepare all relevant attributes
+    void prepare ();
+
+    //! Reserve the maximum amount of output space required
+    void reserve ();
+
+    //! Return the prototype filter coefficients
+    const std::vector<float>& get_coefficients () const { return coefficients; }
+
+  protected:
+
+    //! Perform the polyphase filterbank transformation
+    virtual void transformation ();
+
+    //! Perform the filterbank step
+    virtual void filterbank ();
+
+    //! Perform the filterbank step with the batched FFT
+    void filterbank_batched ();
+
+    //! Compute the prototype filter coefficients
+    void build_coefficients (unsigned nsamp_spectrum, bool analytic);
+
+    //! Prepare the output TimeSeries to hold ndat samples
+    void prepare_output (uint64_t ndat);
+
+    //! Number of taps in each polyphase branch
+    unsigned ntap;
+
+    //! Window applied to the sinc prototype filter
+    Apodization::Type window;
+
+    //! Order of the dimensions in the output TimeSeries
+    TimeSeries::Order output_order;
+
+    //! Prototype filter coefficients, one per input float
+    std::vector<float> coefficients;
+
+    //! When the FFTs of consecutive output samples are batched
+    BatchedFFT::Policy batch;
+
+    //! The batched FFT, if used
+    Reference::To<BatchedFFT> batched_fft;
+
+    //! True if the batched FFT was chosen during prepare
+    bool batched;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,143 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/RealTimeMonitor.h
+
+#ifndef __dsp_RealTimeMonitor_h
+#define __dsp_RealTimeMonitor_h
+
+#include "ReferenceAble.h"
+#include "MJD.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace dsp {
+
+  class Operation;
+  class Observation;
+
+  //! Compares the progress of a pipeline with the passage of real time
+  /*! After each block is processed, the epoch of the last sample in
+    the block is compared with the wall clock.  The lag is the wall
+    time elapsed since start was called minus the observation time
+    elapsed over the same interval; a lag that grows steadily means
+    that the pipeline is slower than real time.
+
+    When the input is a real-time source with a finite buffer, the lag
+    must remain less than the duration of the buffer or data will be
+    lost.  A warning is issued when the lag exceeds a fraction of the
+    buffer, and again if it exceeds the whole buffer.
+
+    The lag, the ratio of observation time to wall time (overall and
+    for each Operation), and the predicted time until the buffer
+    overflows are periodically appended to a file as one JSON object
+    per line, so that monitoring scripts can adjust the number of
+    threads or disable optional stages.  The ratio of each Operation
+    is computed from its OperationStats, which are updated only when
+    Operation::record_time is enabled. */
+  class RealTimeMonitor : public Reference::Able
+  {
+  public:
+
+    //! Default constructor
+    RealTimeMonitor ();
+
+    //! Set the operations for which real-time ratios are reported
+    void set_operations (const std::vector<const Operation*>&);
+
+    //! Set the duration of the input buffer in seconds
+    void set_buffer_seconds (double seconds) { buffer_seconds = seconds; }
+    double get_buffer_seconds () const { return buffer_seconds; }
+
+    //! Set the fraction of the buffer at which a warning is issued
+    void set_warning_fraction (double fraction) { warning_fraction = fraction; }
+
+    //! Set the name of the file to which statistics are appended
+    void set_filename (const std::string& name) { filename = name; }
+
+    //! Set the interval in seconds between reports
+    void set_interval (double seconds) { interval = seconds; }
+
+    //! Set the identifier written with each report
+    void set_thread_id (unsigned id) { thread_id = id; }
+
+    //! Set the stream to which warnings are written (null to disable)
+    void set_warnings (std::ostream* os) { warnings = os; }
+
+    //! Start the clock at the specified epoch of the observation
+    void start (const MJD& epoch);
+
+    //! Record the data processed in one block
+    void add_block (const Observation* data);
+
+    //! Append the current statistics to the file
+    void report ();
+
+    //! Write the current statistics as a single-line JSON object
+    void write (std::ostream&);
+
+    //! Return the current lag in seconds
+    double get_lag () const { return lag; }
+
+    //! Return the ratio of observation time to wall time since start
+    double get_ratio () const;
+
+    //! The current time in seconds since the Unix epoch
+    static double now ();
+
+  protected:
+
+    //! The operations and their wall times at the last report
+    std::vector<const Operation*> operations;
+    std::vector<double> last_op_wall;
+
+    double buffer_seconds;
+    double warning_fraction;
+    double interval;
+    std::string filename;
+    unsigned thread_id;
+    std::ostream* warnings;
+
+    //! The epoch of the observation and wall time at start
+    MJD start_epoch;
+    double start_wall;
+
+    //! Number of blocks processed
+    uint64_t blocks;
+
+    //! Observation time processed by this pipeline
+    double data_seconds;
+
+    //! Observation time elapsed between start and the last block
+    double elapsed_data;
+
+    //! Wall time elapsed between start and the last block
+    double elapsed_wall;
+
+    //! The current lag and its rate of change
+    double lag;
+    double lag_rate;
+
+    //! Values at the last report
+    double last_report_wall;
+    double last_data_seconds;
+    double last_lag;
+
+    //! Set when a warning has been issued for the current excursion
+    bool warned;
+    bool overflowed;
+
+    //! Issue warnings if the lag is approaching the buffer size
+    void check_lag ();
+  };
+
+}
+
+#endif // !defined(__dsp_RealTimeMonitor_h)
@@ -45,6 +45,10 @@ namespace dsp {
     //! Get the zero delay (in samples)
     int64_t get_zero_delay () const;
 
+    //! Return true if the specified input data order can be supported
+    bool get_order_supported (TimeSeries::Order order) const
+    { return order == TimeSeries::OrderFPT; }
+
   protected:
 
     //! The total delay (in samples)
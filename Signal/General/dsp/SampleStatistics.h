@@ -0,0 +1,108 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/SampleStatistics.h
+
+#ifndef __dsp_SampleStatistics_h
+#define __dsp_SampleStatistics_h
+
+#include "dsp/Sink.h"
+#include "dsp/TimeSeries.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Accumulates the first four moments of each channel and polarization
+  /*! The moments of each block are computed about the mean of the
+    block and then merged into the running totals using the pairwise
+    update formulae of Chan, Golub & LeVeque (1979) and Pebay (2008),
+    which are numerically stable and exact; therefore, the results of
+    multiple threads may be combined without loss of precision. */
+  class SampleStatistics : public Sink<TimeSeries>
+  {
+  public:
+
+    //! Mergeable accumulator of the first four central moments
+    class Moments
+    {
+    public:
+
+      //! Default constructor
+      Moments ();
+
+      //! Add ndat samples, separated by stride floats
+      void add (const float* data, uint64_t ndat, unsigned stride);
+
+      //! Merge with the moments of another set of samples
+      void merge (const Moments&);
+
+      //! Get the number of samples
+      uint64_t get_count () const { return count; }
+
+      //! Get the mean
+      double get_mean () const { return mean; }
+
+      //! Get the variance
+      double get_variance () const;
+
+      //! Get the skewness
+      double get_skewness () const;
+
+      //! Get the excess kurtosis (zero for normally distributed samples)
+      double get_kurtosis () const;
+
+    protected:
+
+      uint64_t count;
+      double mean;
+
+      //! Sums of the second, third and fourth powers of the deviations
+      double M2, M3, M4;
+    };
+
+    //! Default constructor
+    SampleStatistics (const char* name = "SampleStatistics");
+
+    //! Add the statistics of another SampleStatistics instance
+    void combine (const Operation*);
+
+    //! Reset the statistics
+    void reset ();
+
+    //! Get the number of frequency channels
+    unsigned get_nchan () const { return nchan; }
+
+    //! Get the number of polarizations
+    unsigned get_npol () const { return npol; }
+
+    //! Get the number of dimensions
+    unsigned get_ndim () const { return ndim; }
+
+    //! Get the moments of the given channel, polarization and dimension
+    const Moments& get_moments (unsigned ichan, unsigned ipol,
+                                unsigned idim = 0) const;
+
+  protected:
+
+    //! Adds the input to the running totals
+    void calculation ();
+
+    //! Resize the accumulators
+    void resize (unsigned nchan, unsigned npol, unsigned ndim);
+
+    //! The moments, in FPD order
+    std::vector<Moments> moments;
+
+    unsigned nchan;
+    unsigned npol;
+    unsigned ndim;
+  };
+}
+
+#endif
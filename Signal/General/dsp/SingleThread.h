@@ -12,6 +12,7 @@
 #define __dspsr_SingleThread_h
 
 #include "dsp/Pipeline.h"
+#include "dsp/TimeSeries.h"
 #include "CommandLine.h"
 #include "Functor.h"
 #include "TextEditor.h"
@@ -21,11 +22,13 @@ class ThreadContext;
 namespace dsp {
 
   class IOManager;
-  class TimeSeries;
   class Operation;
   class Observation;
   class Scratch;
   class Memory;
+  class BlockSizeTuner;
+  class RealTimeMonitor;
+  class LoadShedder;
 
   //! A single Pipeline thread
   class SingleThread : public Pipeline
@@ -72,9 +75,18 @@ namespace dsp {
     //! Finish everything
     void finish ();
 
+    //! Stop reading data after the current block
+    void stop () { stopped = true; }
+
     //! Get the minimum number of samples required to process
     uint64_t get_minimum_samples () const;
 
+    //! Get the number of operations in the pipeline
+    unsigned get_noperation () const { return operations.size(); }
+
+    //! Get the specified operation
+    Operation* get_operation (unsigned iop);
+
     //! The verbose output stream shared by all operations
     std::ostream cerr;
 
@@ -89,6 +101,9 @@ namespace dsp {
     //! Any special operations that must be performed at the end of data
     virtual void end_of_data ();
 
+    //! Called after each block of data has been processed
+    virtual void end_of_block () { }
+
     //! Pointer to the ostream
     std::ostream* log;
 
@@ -109,6 +124,9 @@ namespace dsp {
     //! Processing state
     State state;
 
+    //! Set by stop; checked before each block is read
+    bool stopped;
+
     //! Error status
     Error error;
 
@@ -137,15 +155,61 @@ namespace dsp {
     //! The operations to be performed
     std::vector< Reference::To<Operation> > operations;
 
+    //! Append a Transpose of data into the specified order
+    TimeSeries* transpose (TimeSeries* data, TimeSeries::Order order);
+
     //! Insert a dump point before the named operation
     void insert_dump_point (const std::string& transformation_name);
 
+    //! Remove the input buffering of stages that can use overlapping blocks
+    void disable_input_buffering ();
+
+    //! Replace the inputs of buffering stages with RingTimeSeries
+    void use_ring_buffers ();
+
+    //! Return true if any operation transforms the data in place
+    bool transformed_in_place (const TimeSeries*);
+
+    //! Return the input overlap (in unpacked samples) required by delays
+    uint64_t get_delay_overlap ();
+
+    //! Add the delay overlap to the minimum block size and block overlap
+    void add_delay_overlap (uint64_t& minimum_samples,
+                            uint64_t& block_overlap);
+
     //! The scratch space shared by all operations
     Reference::To<Scratch> scratch;
 
     //! The minimum number of samples required to process
     uint64_t minimum_samples;
 
+    //! Chooses the block size during the first blocks of run
+    Reference::To<BlockSizeTuner> tuner;
+
+    //! Prepare the block size tuner; return false if tuning is not possible
+    bool prepare_tuner ();
+
+    //! Return the total time spent by all operations
+    double get_operations_time () const;
+
+    //! Get the operations reported, with the Input and Unpacker separated
+    void get_report_operations (std::vector<const Operation*>&) const;
+
+    //! Write the performance counters of all operations to the named file
+    void write_performance_report (const std::string& filename) const;
+
+    //! Compares the progress of the pipeline with real time
+    Reference::To<RealTimeMonitor> monitor;
+
+    //! Prepare the real-time monitor; return false if it is not required
+    bool prepare_monitor ();
+
+    //! Degrades optional stages when the pipeline falls behind real time
+    Reference::To<LoadShedder> shedder;
+
+    //! Return the load shedder, or null if load shedding is disabled
+    LoadShedder* get_shedder ();
+
     Reference::To<Memory> device_memory;
     void* gpu_stream;
     int gpu_device;
@@ -196,6 +260,9 @@ namespace dsp {
     //! report the percentage finished
     bool report_done;
 
+    //! report the time spent performing each operation
+    bool report_time;
+
     //! run repeatedly on the same input
     bool run_repeatedly;
 
@@ -216,14 +283,48 @@ namespace dsp {
     void set_fft_library (std::string);
 
     //! use input-buffering to compensate for operation edge effects
+    /*! When false, the edge effects of the filterbank, convolution and
+      delay stages are compensated by overlapping consecutive input
+      blocks, so that threads never wait on one another. */
     bool input_buffering;
 
+    //! retain buffered samples in double-mapped ring buffers
+    bool ring_buffering;
+
+    //! choose the block size that maximizes throughput
+    bool autotune_block_size;
+
     //! use weighted time series to flag bad data
     bool weighted_time_series;
 
     //! dump points
     std::vector<std::string> dump_before;
 
+    //! file to which performance counters are written (.csv or JSON)
+    std::string performance_report;
+
+    //! interval in seconds between periodic performance reports
+    double performance_interval;
+
+    //! file to which real-time latency statistics are appended (JSON lines)
+    std::string realtime_report;
+
+    //! interval in seconds between real-time latency reports
+    double realtime_interval;
+
+    //! duration of the real-time input buffer in seconds
+    /*! If zero, the duration is derived from the input when possible */
+    double realtime_buffer;
+
+    //! degrade optional stages when falling behind real time
+    bool load_shedding;
+
+    //! file to which the timeline of pipeline events is written
+    std::string trace_filename;
+
+    //! record the timeline of pipeline events and write it to file
+    void set_trace (std::string filename);
+
     //! get the number of buffers required to process the data
     unsigned get_nbuffers () const { return buffers; }
 
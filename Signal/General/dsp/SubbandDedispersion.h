@@ -0,0 +1,157 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/SubbandDedispersion.h
+
+#ifndef __dsp_SubbandDedispersion_h
+#define __dsp_SubbandDedispersion_h
+
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+
+#include <vector>
+
+namespace dsp {
+
+  //! Incoherently dedisperses detected data at many trial DMs in one pass
+  /*! The channels are divided into subbands and the dedispersion is
+    performed in two stages.  In the first stage, the channels in each
+    subband are summed after removing the dispersion delays within the
+    subband at a nominal DM; each nominal DM is shared by a group of
+    neighbouring trial DMs, chosen such that the error in the delays
+    within a subband does not exceed the tolerance.  In the second
+    stage, the partial sums of each group are summed after removing the
+    delays between the subbands at each trial DM.  The cost therefore
+    scales as nchan*ngroup + nsubband*ndm instead of nchan*ndm.
+
+    The delays are computed relative to the highest frequency and the
+    start time of each output is referred to the centre frequency, as
+    is done by SampleDelay.  Each output contains a single channel and
+    polarization.  The input must be detected with a single polarization
+    and may be in either FPT or TFP order. */
+  class SubbandDedispersion : public Transformation<TimeSeries,TimeSeries>
+  {
+
+  public:
+
+    //! Default constructor
+    SubbandDedispersion ();
+
+    //! Set the trial dispersion measures
+    void set_dispersion_measures (const std::vector<double>&);
+
+    //! Get the number of trial dispersion measures
+    unsigned get_ndm () const { return dispersion_measures.size(); }
+
+    //! Get the specified trial dispersion measure
+    double get_dispersion_measure (unsigned idm) const
+    { return dispersion_measures.at (idm); }
+
+    //! Set the number of subbands (0 = choose automatically)
+    void set_nsubband (unsigned n) { nsubband = n; built = false; }
+
+    //! Get the number of subbands
+    unsigned get_nsubband () const { return nsubband; }
+
+    //! Set the maximum error in the delays within a subband (in samples)
+    void set_tolerance (double samples) { tolerance = samples; built = false; }
+
+    //! Get the maximum error in the delays within a subband
+    double get_tolerance () const { return tolerance; }
+
+    //! Get the number of nominal DMs used in the first stage
+    unsigned get_ngroup () const { return group_dm.size(); }
+
+    using Transformation<TimeSeries,TimeSeries>::set_output;
+    using Transformation<TimeSeries,TimeSeries>::get_output;
+
+    //! Set the output of the specified trial DM (idm=0 is the output)
+    void set_output (unsigned idm, TimeSeries*);
+
+    //! Get the output of the specified trial DM
+    TimeSeries* get_output (unsigned idm);
+
+    //! Computes the delays and prepares the input buffer
+    void prepare ();
+
+    //! Get the total delay (in samples)
+    uint64_t get_total_delay () const { return total_delay; }
+
+  protected:
+
+    //! Dedisperses the input
+    void transformation ();
+
+    //! Computes the subbands, groups and delays
+    void build ();
+
+    //! Returns the dispersion delay between two frequencies (in samples)
+    double delay (double dm, double freq, double ref) const;
+
+    //! Copy the input into FPT order, one row per channel
+    const float* get_fpt (uint64_t ndat);
+
+    //! The trial dispersion measures
+    std::vector<double> dispersion_measures;
+
+    //! The outputs of trial DMs other than the first
+    std::vector< Reference::To<TimeSeries> > outputs;
+
+    //! The number of subbands
+    unsigned nsubband;
+
+    //! The maximum error in the delays within a subband (in samples)
+    double tolerance;
+
+    //! The first channel of each subband, and one past the last
+    std::vector<unsigned> subband_start;
+
+    //! The reference (highest) frequency of each subband
+    std::vector<double> subband_freq;
+
+    //! The nominal DM of each group
+    std::vector<double> group_dm;
+
+    //! The group of each trial DM
+    std::vector<unsigned> dm_group;
+
+    //! Delay of each channel within its subband, for each group [group][chan]
+    std::vector< std::vector<unsigned> > channel_delay;
+
+    //! Delay of each subband, for each trial DM [dm][subband]
+    std::vector< std::vector<unsigned> > subband_delay;
+
+    //! Offset of the centre frequency for each trial DM (in samples)
+    std::vector<int64_t> centre_delay;
+
+    //! Length of the partial sums required by each group, beyond ndat
+    std::vector<uint64_t> group_extra;
+
+    //! The total delay (in samples)
+    uint64_t total_delay;
+
+    //! Partial sums [group][subband][time]
+    std::vector<float> partial;
+
+    //! Transposed copy of TFP input
+    std::vector<float> transposed;
+
+    //! Attributes of the input for which the delays were built
+    unsigned built_nchan;
+    double built_rate;
+    double built_centre_frequency;
+    double built_bandwidth;
+
+    //! Flag set when delays have been initialized
+    bool built;
+
+  };
+
+}
+
+#endif
@@ -55,6 +55,10 @@ namespace dsp {
 
     virtual void transformation ();
 
+    //! Copy a range of channels to the output, offset by shift channels
+    void order_channels (unsigned chan_begin, unsigned chan_end,
+                         int shift, uint64_t ndat);
+
     //! The most rapidly changing variable
     ChangingVariable rapid;
 
@@ -0,0 +1,76 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/General/dsp/Transpose.h
+
+#ifndef __dsp_Transpose_h
+#define __dsp_Transpose_h
+
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+
+namespace dsp {
+
+  //! Converts a TimeSeries between FPT and TFP order
+  /*! The data are treated as a matrix with one row for each channel
+    and polarization and one column for each time sample, where each
+    element contains ndim floats.  The matrix is transposed recursively,
+    halving the longer dimension until each tile fits in the L1 cache,
+    so that both the reads and the writes make good use of every cache
+    line regardless of the shape of the data.  When the input and output
+    are the same TimeSeries, the data are transposed through scratch
+    space.
+
+    Stages that accept only one order advertise this through
+    get_order_supported; the pipeline builders append a Transpose only
+    when the data are not already in a supported order. */
+  class Transpose : public Transformation <TimeSeries, TimeSeries>
+  {
+
+  public:
+
+    //! Default constructor
+    Transpose ();
+
+    //! Set the order of the dimensions in the output TimeSeries
+    void set_output_order (TimeSeries::Order order) { output_order = order; }
+
+    //! Get the order of the dimensions in the output TimeSeries
+    TimeSeries::Order get_output_order () const { return output_order; }
+
+    //! Return true if the specified input data order can be supported
+    bool get_order_supported (TimeSeries::Order) const { return true; }
+
+    //! Transpose a matrix of nrow by ncol elements of ndim floats
+    /*! Element (irow,icol) is read from from[irow*from_stride+icol*ndim]
+      and written to to[icol*to_stride+irow*ndim]. */
+    static void transpose (float* to, uint64_t to_stride,
+                           const float* from, uint64_t from_stride,
+                           uint64_t nrow, uint64_t ncol, unsigned ndim);
+
+    //! Return the number of floats between consecutive FPT rows
+    /*! Each polarization of each channel is a row, and the rows of
+      a TimeSeries in FPT order are equally spaced. */
+    static uint64_t get_fpt_stride (const TimeSeries*);
+
+  protected:
+
+    //! Perform the transposition
+    void transformation ();
+
+    //! Transpose the data in place, through scratch space
+    void transpose_inplace (uint64_t ndat, uint64_t nrow, unsigned ndim);
+
+    //! The order of the dimensions in the output TimeSeries
+    TimeSeries::Order output_order;
+
+  };
+
+}
+
+#endif // !defined(__dsp_Transpose_h)
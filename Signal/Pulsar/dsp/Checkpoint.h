@@ -0,0 +1,87 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/Pulsar/dsp/Checkpoint.h
+
+#ifndef __dsp_Checkpoint_h
+#define __dsp_Checkpoint_h
+
+#include "ReferenceAble.h"
+#include "MJD.h"
+#include "Error.h"
+
+#include <fstream>
+#include <string>
+
+namespace dsp {
+
+  //! A compact binary snapshot of the state of a pipeline
+  /*! Each class that can be checkpointed writes its state with the
+    write methods and reads it back, in the same order, with the read
+    methods.  Values are stored in the native byte order, and so a
+    snapshot can be resumed only on a machine of the same architecture.
+
+    A snapshot is written to a temporary file that replaces the named
+    file when closed, so that the last complete snapshot survives if
+    the process is killed while writing the next one. */
+  class Checkpoint : public Reference::Able
+  {
+  public:
+
+    //! Default constructor
+    Checkpoint ();
+
+    //! Create a new snapshot to be written to the named file
+    void create (const std::string& filename);
+
+    //! Replace the named file with the completed snapshot
+    void close ();
+
+    //! Open the named snapshot; return false if the file does not exist
+    bool open (const std::string& filename);
+
+    //! Get the name of the snapshot file
+    const std::string& get_filename () const { return filename; }
+
+    //! Write a value of plain-old-data type
+    template<typename T> void write (const T& value)
+    { write_bytes (&value, sizeof(T)); }
+
+    //! Write an array of plain-old-data type
+    template<typename T> void write (const T* data, uint64_t count)
+    { write_bytes (data, count * sizeof(T)); }
+
+    //! Read a value of plain-old-data type
+    template<typename T> void read (T& value)
+    { read_bytes (&value, sizeof(T)); }
+
+    //! Read an array of plain-old-data type
+    template<typename T> void read (T* data, uint64_t count)
+    { read_bytes (data, count * sizeof(T)); }
+
+    //! Write an epoch without loss of precision
+    void write (const MJD&);
+
+    //! Read an epoch
+    void read (MJD&);
+
+  protected:
+
+    void write_bytes (const void* data, uint64_t nbyte);
+    void read_bytes (void* data, uint64_t nbyte);
+
+    std::string filename;
+    std::string temp;
+
+    std::ofstream out;
+    std::ifstream in;
+  };
+
+}
+
+#endif // !defined(__dsp_Checkpoint_h)
@@ -25,6 +25,7 @@ namespace dsp
 {
   class WeightedTimeSeries;
   class ObservationChange;
+  class Checkpoint;
 
   //! Fold TimeSeries data into phase-averaged profile(s)
   /*! 
@@ -103,6 +104,22 @@ namespace dsp
     //! Set the reference epoch that defines phase = 0 when folding_period > 0
     void set_reference_epoch (const MJD&);
 
+    //! Fold only the time samples that fall in the specified interval
+    /*! Time samples outside of [start,end) are ignored; this is used
+      when the data are divided between processes with some overlap. */
+    void set_interval (const MJD& start, const MJD& end);
+
+    //! Get the end of the last time sample folded
+    MJD get_folded_end () const { return folded_end; }
+
+    //! Write the folded profiles to a checkpoint
+    virtual void save (Checkpoint&) const;
+
+    //! Restore the folded profiles from a checkpoint
+    /*! The profiles are restored when the first block of data is
+      folded, after the output has been prepared for the input. */
+    virtual void load (Checkpoint&);
+
     //! Get the period at which data are being folded (in seconds)
     double get_folding_period () const;
 
@@ -160,6 +177,9 @@ namespace dsp
     //! Set the idat_start and ndat_fold attributes
     virtual void set_limits (const Observation* input);
 
+    //! Restrict idat_start and ndat_fold to the interval, if set
+    void apply_interval (const Observation* input);
+
     //! Check that the input state is appropriate for folding
     virtual void check_input();
 
@@ -201,6 +221,24 @@ namespace dsp
     //! Reference epoch that defines phase = 0 when folding_period > 0
     MJD reference_epoch;
 
+    //! Start of the interval to be folded (MJD::zero if unset)
+    MJD interval_start;
+
+    //! End of the interval to be folded (MJD::zero if unset)
+    MJD interval_end;
+
+    //! End of the last time sample folded
+    MJD folded_end;
+
+    //! Profiles restored from a checkpoint
+    class Snapshot;
+
+    //! Restored profiles to be added to the output
+    Reference::To<Snapshot> snapshot;
+
+    //! Add the restored profiles to the output
+    void apply_snapshot ();
+
     //! Number of polynomial coefficients in model
     unsigned ncoef;
 
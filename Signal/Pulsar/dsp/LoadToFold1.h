@@ -14,6 +14,8 @@
 #include "dsp/SingleThread.h"
 #include "dsp/Filterbank.h"
 
+#include <time.h>
+
 namespace dsp {
 
   class TimeSeries;
@@ -80,9 +82,24 @@ namespace dsp {
     //! Wrap up tasks at end of data
     void end_of_data ();
 
+    //! Write a checkpoint if the checkpoint interval has elapsed
+    void end_of_block ();
+
+    //! Return the number of samples that must be loaded before those folded
+    uint64_t get_margin ();
+
+    //! Return the first sample to load in order to fold from offset
+    /*! Both offsets are counted in input samples from the start of the
+      data requested; the result is aligned to the samples folded. */
+    uint64_t get_load_start (uint64_t offset);
+
     //! Return true if the output will be divided into sub-integrations
     bool output_subints () const;
 
+    //! Combine the results of parallel processes before unloading
+    /*! Returns false if this process should not unload the result */
+    virtual bool gather_results () { return true; }
+
     //! The dedispersion kernel
     Reference::To<Dedispersion> kernel;
 
@@ -153,6 +170,10 @@ namespace dsp {
     void configure_fold (unsigned ifold, TimeSeries* to_fold);
     void configure_detection (Detection*, unsigned);
 
+    //! Configure SK zapping of the given TimeSeries
+    void configure_sk (SpectralKurtosis*, TimeSeries* input,
+                       TimeSeries* output);
+
     PhaseSeriesUnloader* get_unloader (unsigned ifold);
     size_t get_nfold ();
 
@@ -165,6 +186,18 @@ namespace dsp {
 
     //! Parse the epoch string into a reference epoch
     MJD parse_epoch (const std::string&);
+
+    //! Check that the pipeline can be checkpointed and resume if requested
+    void prepare_checkpoint ();
+
+    //! Save the state of all fold instances to the checkpoint file
+    void write_checkpoint ();
+
+    //! Restore the state of all fold instances and seek the input
+    void resume ();
+
+    //! Wall time at which the last checkpoint was written
+    time_t last_checkpoint;
   };
 
 }
@@ -71,6 +71,9 @@ namespace dsp {
     // dispersion measure used in coherent dedispersion
     double dispersion_measure;
 
+    // additional trial dispersion measures, each folded into its own archive
+    std::vector<double> dm_trials;
+
     // zap RFI during convolution
     bool zap_rfi;
 
@@ -162,6 +165,15 @@ namespace dsp {
     // number of sub-integrations written to a single file
     unsigned subints_per_archive;
 
+    // periodically save the folded profiles to this file
+    std::string checkpoint_filename;
+
+    // wall time in seconds between checkpoints
+    double checkpoint_interval;
+
+    // resume from the checkpoint file, if it exists
+    bool resume;
+
     void single_pulse()
     {
       integration_turns = 1;
@@ -0,0 +1,96 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/Pulsar/dsp/LoadToFoldMPI.h
+
+#ifndef __dspsr_LoadToFoldMPI_h
+#define __dspsr_LoadToFoldMPI_h
+
+#include <mpi.h>
+
+#include "dsp/LoadToFold1.h"
+
+namespace dsp {
+
+  class PhaseSeries;
+
+  //! Divides the time range of one observation between MPI processes
+  /*! Each process in the communicator folds a contiguous share of the
+    data, e.g. with
+
+    mpirun -np 4 dspsr -L 10 ...
+
+    When sub-integrations are produced, the boundaries between the
+    shares fall on sub-integration boundaries that are common to all
+    processes, so that each process unloads complete sub-integrations.
+    When a single archive is produced, the PhaseSeries of all processes
+    are summed by MPI_Reduce and unloaded by the root process.
+
+    Each process loads enough data either side of its share to fill
+    the block overlap and inter-channel delays of the pipeline; only the
+    samples in its own share are folded (see Fold::set_interval).
+
+    The test_LoadToFoldMPI program, run by make check with 3 processes,
+    checks that the folds of each process equal those of a single
+    process; the script test_LoadToFoldMPI.csh does the same for the
+    archives produced by dspsr from a real observation. */
+  class LoadToFoldMPI : public LoadToFold
+  {
+
+  public:
+
+    //! Constructor
+    LoadToFoldMPI (Config* config, MPI_Comm comm);
+
+    //! Get the number of processes in the communicator
+    int get_size () const { return mpi_size; }
+
+    //! Get the rank of this process within the communicator
+    int get_rank () const { return mpi_rank; }
+
+    //! Get the rank of the process that unloads a single archive
+    int get_root () const { return mpi_root; }
+    //! Set the rank of the process that unloads a single archive
+    void set_root (int root);
+
+    //! Finish preparing and select the share of this process
+    void prepare ();
+
+  protected:
+
+    //! Sum the results of all processes on the root process
+    bool gather_results ();
+
+    //! Select the share of the input to be processed by this process
+    void partition ();
+
+    //! Sum the PhaseSeries of all processes on the root process
+    void reduce (PhaseSeries*);
+
+    //! Configuration parameters
+    Reference::To<Config> configuration;
+
+    //! The start of the data to be divided between processes
+    MJD epoch;
+
+    //! The communicator
+    MPI_Comm mpi_comm;
+
+    //! The number of processes in the communicator
+    int mpi_size;
+
+    //! The rank of this process
+    int mpi_rank;
+
+    //! The rank of the process that unloads a single archive
+    int mpi_root;
+  };
+
+}
+
+#endif // !defined(__dspsr_LoadToFoldMPI_h)
@@ -136,6 +136,9 @@ namespace dsp {
     //! Return the total number of time samples
     uint64_t get_ndat_total () const;
 
+    //! Set the total number of time samples
+    void set_ndat_total (uint64_t ndat) { ndat_total = ndat; }
+
     //! Return the number of time samples folded into the profiles for all channels
     uint64_t get_ndat_folded () const;
 
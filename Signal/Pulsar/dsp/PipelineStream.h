@@ -0,0 +1,197 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by the dspsr developers
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// dspsr/Signal/Pulsar/dsp/PipelineStream.h
+
+#ifndef __dspsr_PipelineStream_h
+#define __dspsr_PipelineStream_h
+
+#include "dsp/Pipeline.h"
+#include "dsp/Transformation.h"
+#include "dsp/TimeSeries.h"
+
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+class ThreadContext;
+
+namespace dsp {
+
+  class SingleThread;
+
+  //! Runs a Pipeline in the background and hands its blocks to a consumer
+  /*! The Pipeline (either a SingleThread or a MultiThread) is run in a
+    separate thread, so that the entire signal path executes without
+    the intervention of the caller.  After the output of each watched
+    operation is computed, the processing thread passes the output to
+    the consumer and waits until the consumer calls next again; the
+    consumer may therefore read the output in place, without copying.
+
+    Observers receive the output of the named operations in the
+    processing thread, as soon as it is computed.  The interface is
+    designed for the Python bindings, where the consumer and the
+    observers are written in Python and the Python interpreter lock is
+    released during next. */
+
+  class PipelineStream : public Reference::Able
+  {
+
+  public:
+
+    //! Receives the output of an operation in the processing thread
+    class Observer : public Reference::Able
+    {
+    public:
+      //! Called after the operation has computed its output
+      virtual void block (Operation*, const TimeSeries*) = 0;
+    };
+
+    //! Constructor
+    PipelineStream (Pipeline* pipeline = 0);
+
+    //! Destructor stops the pipeline and waits for the processing thread
+    ~PipelineStream ();
+
+    //! Set the pipeline to be run
+    void set_pipeline (Pipeline*);
+
+    //! Get the pipeline to be run
+    Pipeline* get_pipeline () { return pipeline; }
+
+    //! Pass the output of the named operation(s) to next
+    void watch (const std::string& operation_name);
+
+    //! Pass the output of the named operation(s) to the observer
+    void add_observer (const std::string& operation_name, Observer*);
+
+    //! Start the processing thread
+    void start ();
+
+    //! Return the next block of output, or null at the end of data
+    /*! The block returned by the previous call to next is released;
+      the processing thread that produced it will not continue until
+      then.  Any error raised by the pipeline is thrown here. */
+    const TimeSeries* next ();
+
+    //! Get the operation that produced the block returned by next
+    Operation* get_operation () { return current_operation; }
+
+    //! Stop passing blocks to next and end the pipeline
+    /*! The pipeline stops reading data after the block in progress
+      (see Pipeline::stop); Pipeline::finish is still called by the
+      processing thread, so that the data already processed are
+      unloaded as at the end of data. */
+    void stop ();
+
+    //! Stop and wait for the processing thread to finish
+    /*! The processing thread calls Pipeline::finish after
+      Pipeline::run returns.  Any error raised by the pipeline or by an
+      observer is thrown here. */
+    void wait ();
+
+    //! Return true if the processing thread is running
+    bool get_running () const { return running; }
+
+    //! Report an error raised by an observer
+    void set_error (const Error&);
+
+  protected:
+
+    //! Connects to the post_transformation callback of an operation
+    template<class In, class Out> class Hook;
+
+    //! An operation name and its consumers
+    struct Target
+    {
+      std::string name;
+      bool stream;
+      std::vector< Reference::To<Observer> > observers;
+    };
+
+    //! The pipeline
+    Reference::To<Pipeline> pipeline;
+
+    //! The watched operations
+    std::vector<Target> targets;
+
+    //! The hooks connected to each operation
+    std::vector< Reference::To<Reference::Able> > hooks;
+
+    //! Connect a hook to each watched operation of the thread
+    void connect (SingleThread*);
+
+    //! Connect a hook if the operation is a Transformation<In,Out>
+    template<class In, class Out> bool connect (Operation*, unsigned itarget);
+
+    //! Called in the processing thread after each watched operation
+    void deliver (unsigned itarget, Operation*, const TimeSeries*);
+
+    //! Body of the processing thread
+    static void* run (void*);
+
+    //! Protects the following attributes
+    ThreadContext* context;
+
+    //! The block ready for (or taken by) the consumer
+    const TimeSeries* current;
+    Operation* current_operation;
+
+    //! Sequence number of the last block delivered and released
+    uint64_t delivered;
+    uint64_t released;
+
+    //! True when the current block has been taken by the consumer
+    bool taken;
+
+    bool stopped;
+    bool running;
+    bool started;
+
+    //! Error raised in the processing thread
+    Error error;
+    bool failed;
+
+    //! The processing thread
+    pthread_t id;
+
+  };
+
+  template<class In, class Out>
+  class PipelineStream::Hook : public Reference::Able
+  {
+  public:
+
+    Hook (PipelineStream* _stream, unsigned _itarget)
+    { stream = _stream; itarget = _itarget; }
+
+    void post (Transformation<In,Out>* xform)
+    { stream->deliver (itarget, xform, xform->get_output()); }
+
+  protected:
+
+    PipelineStream* stream;
+    unsigned itarget;
+  };
+
+  template<class In, class Out>
+  bool PipelineStream::connect (Operation* op, unsigned itarget)
+  {
+    Transformation<In,Out>* xform = dynamic_cast<Transformation<In,Out>*>(op);
+    if (!xform)
+      return false;
+
+    Hook<In,Out>* hook = new Hook<In,Out> (this, itarget);
+    hooks.push_back (hook);
+    xform->post_transformation.connect (hook, &Hook<In,Out>::post);
+    return true;
+  }
+
+}
+
+#endif // !defined(__dspsr_PipelineStream_h)
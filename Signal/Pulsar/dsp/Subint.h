@@ -115,6 +115,12 @@ namespace dsp {
     //! Access to the divider
     const TimeDivide* get_divider () const { return &divider; }
 
+    //! Write the partial sub-integration to a checkpoint
+    void save (Checkpoint&) const;
+
+    //! Restore the partial sub-integration from a checkpoint
+    void load (Checkpoint&);
+
     //! Set verbosity ostream
     void set_cerr (std::ostream& os) const;
 
@@ -317,6 +323,20 @@ void dsp::Subint<Op>::set_limits (const Observation* input)
   Op::ndat_fold = divider.get_ndat ();
 }
 
+template <class Op>
+void dsp::Subint<Op>::save (Checkpoint& checkpoint) const
+{
+  Op::save (checkpoint);
+  divider.save (checkpoint);
+}
+
+template <class Op>
+void dsp::Subint<Op>::load (Checkpoint& checkpoint)
+{
+  Op::load (checkpoint);
+  divider.load (checkpoint);
+}
+
 template <class Op>
 void dsp::Subint<Op>::finish () try
 {
@@ -18,6 +18,7 @@
 namespace dsp {
 
   class Observation;
+  class Checkpoint;
 
   //! Calculates the boundaries of a division of time
   class TimeDivide : public OwnStream {
@@ -124,6 +125,12 @@ namespace dsp {
 
     //@}
 
+    //! Write the state of the current division to a checkpoint
+    void save (Checkpoint&) const;
+
+    //! Restore the state of the current division from a checkpoint
+    void load (Checkpoint&);
+
   protected:
 
     //! The start time from which to begin dividing time
@@ -12,6 +12,12 @@
 #include "dsp/PearsonIV.h"
 #include "dsp/NewtonRaphson.h"
 
+#include <pthread.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
 namespace dsp {
 
   class SKLimits {
@@ -24,6 +30,9 @@ namespace dsp {
 
     int calc_limits ();
 
+    //! Retrieve the limits from the shared Table, computing them if necessary
+    int lookup_limits ();
+
     double get_lower_threshold() { return lower_threshold; }
 
     double get_upper_threshold() { return upper_threshold; }
@@ -32,6 +41,9 @@ namespace dsp {
 
     void set_std_devs ( unsigned _std_devs ) { std_devs = _std_devs; }
 
+    //! Thresholds shared by all threads and saved between runs
+    class Table;
+
   private:
 
     //! Calculate the first four moments of the distribution and ancilliary parameters
@@ -49,6 +61,68 @@ namespace dsp {
 
     unsigned verbose;
   };
+
+  //! Thresholds computed by SKLimits::calc_limits
+  /*! Each pair of thresholds is computed once and shared by all threads.
+    The thresholds are also saved to a file in the run-time data
+    directory, alongside the FFT benchmarks used by OptimalFFT, so
+    that subsequent processes need not compute them again.
+
+    When interpolation is enabled, the thresholds for a value of M
+    that is not in the table are interpolated between the two nearest
+    nodes of a grid with 16 values of M per octave; this limits the
+    number of thresholds that must be computed when M varies between
+    frequency channels. */
+  class SKLimits::Table
+  {
+  public:
+
+    //! Default constructor
+    Table ();
+
+    //! Return the table shared by all threads
+    static Table* get_instance ();
+
+    //! Return the values of M at the nodes of the interpolation grid
+    static const std::vector<unsigned>& get_grid ();
+
+    //! Set the name of the file in which thresholds are saved
+    void set_filename (const std::string&);
+
+    //! Interpolate between grid nodes when M is not in the table
+    void set_interpolate (bool flag) { interpolate = flag; }
+
+    //! Get the thresholds for the specified M and number of std deviations
+    void get_limits (unsigned M, unsigned std_devs,
+                     double& lower, double& upper);
+
+    //! Compute the thresholds at every node of the grid
+    void precompute (unsigned std_devs);
+
+  protected:
+
+    //! Return the memoised thresholds, computing them if necessary
+    void get_exact (unsigned M, unsigned std_devs,
+                    double& lower, double& upper);
+
+    //! Load the thresholds saved in the file
+    void load ();
+
+    //! Append thresholds to the file
+    void save (unsigned M, unsigned std_devs, double lower, double upper);
+
+    typedef std::pair<unsigned,unsigned> Key;
+    typedef std::pair<double,double> Limits;
+
+    //! The thresholds, indexed by M and std_devs
+    std::map<Key,Limits> limits;
+
+    std::string filename;
+    bool loaded;
+    bool interpolate;
+
+    pthread_mutex_t mutex;
+  };
 }
 
 #endif
@@ -1,4 +1,4 @@
-%module dspsr
+%module("threads"="1") dspsr
 %{
 #define SWIG_FILE_WITH_INIT
 #include "numpy/noprefix.h"
@@ -15,6 +15,16 @@
 #include "dsp/Dedispersion.h"
 #include "dsp/Response.h"
 #include "dsp/Convolution.h"
+#include "dsp/File.h"
+#include "dsp/PhaseSeries.h"
+#include "dsp/Pipeline.h"
+#include "dsp/SingleThread.h"
+#include "dsp/MultiThread.h"
+#include "dsp/LoadToFil.h"
+#include "dsp/LoadToFilN.h"
+#include "dsp/LoadToFoldConfig.h"
+#include "dsp/LoadToFoldN.h"
+#include "dsp/PipelineStream.h"
 
 %}
 
@@ -44,6 +54,24 @@ using namespace std;
   import_array();
 %}
 
+// The interpreter lock is released only where the C++ code runs for a
+// long time and does not touch any Python objects; i.e. while running
+// a pipeline or waiting for its next block of output.
+%nothread;
+%thread dsp::Pipeline::run;
+%thread dsp::Pipeline::finish;
+%thread dsp::Pipeline::open;
+%thread dsp::SingleThread::run;
+%thread dsp::SingleThread::finish;
+%thread dsp::MultiThread::run;
+%thread dsp::MultiThread::finish;
+%thread dsp::LoadToFold::run;
+%thread dsp::LoadToFold::finish;
+%thread dsp::LoadToFoldN::finish;
+%thread dsp::LoadToFilN::finish;
+%thread dsp::PipelineStream::next;
+%thread dsp::PipelineStream::wait;
+
 // Declare functions that return a newly created object
 // (Helps memory management)
 //%newobject Pulsar::Archive::new_Archive;
@@ -55,6 +83,21 @@ using namespace std;
 // variables act like Reference::To pointers.
 %feature("ref")   Reference::Able "pointer_tracker_add($this);"
 %feature("unref") Reference::Able "pointer_tracker_remove($this);"
+
+// The processing thread of a PipelineStream may be waiting for the
+// interpreter lock in a PythonObserver; therefore, it is stopped and
+// joined with the lock released before the stream is destroyed.
+%feature("unref") dsp::PipelineStream %{
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        $this->wait();
+    }
+    catch (Error& error) {
+        std::cerr << error << std::endl;
+    }
+    Py_END_ALLOW_THREADS
+    pointer_tracker_remove($this);
+%}
 %header %{
 std::vector< Reference::To<Reference::Able> > _pointer_tracker;
 void pointer_tracker_add(Reference::Able *ptr) {
@@ -70,6 +113,69 @@ void pointer_tracker_remove(Reference::Able *ptr) {
 }
 %}
 
+%header %{
+// Return a Python proxy of the most derived type, or None if null
+PyObject* wrap_time_series (const dsp::TimeSeries* data)
+{
+    if (!data)
+        Py_RETURN_NONE;
+
+    dsp::TimeSeries* ptr = const_cast<dsp::TimeSeries*> (data);
+    dsp::PhaseSeries* phase = dynamic_cast<dsp::PhaseSeries*> (ptr);
+
+    if (phase)
+        return SWIG_NewPointerObj (phase, SWIGTYPE_p_dsp__PhaseSeries, 0);
+    else
+        return SWIG_NewPointerObj (ptr, SWIGTYPE_p_dsp__TimeSeries, 0);
+}
+
+// Call a Python function with the output of each block in the
+// processing thread; the arguments are the operation name and the
+// TimeSeries, which may be viewed (but not kept) without copying.
+class PythonObserver : public dsp::PipelineStream::Observer
+{
+    PyObject* callable;
+
+public:
+
+    PythonObserver (PyObject* _callable)
+    {
+        callable = _callable;
+        Py_INCREF (callable);
+    }
+
+    ~PythonObserver ()
+    {
+        PyGILState_STATE state = PyGILState_Ensure ();
+        Py_DECREF (callable);
+        PyGILState_Release (state);
+    }
+
+    void block (dsp::Operation* op, const dsp::TimeSeries* data)
+    {
+        PyGILState_STATE state = PyGILState_Ensure ();
+
+        PyObject* name = PyString_FromString (op->get_name().c_str());
+        PyObject* series = wrap_time_series (data);
+        PyObject* result = PyObject_CallFunctionObjArgs (callable, name, series, NULL);
+
+        bool failed = result == NULL;
+        if (failed)
+            PyErr_Print ();
+
+        Py_XDECREF (result);
+        Py_XDECREF (series);
+        Py_XDECREF (name);
+
+        PyGILState_Release (state);
+
+        if (failed)
+            throw Error (InvalidState, "PythonObserver::block",
+                         "exception raised by callback on " + op->get_name());
+    }
+};
+%}
+
 // Non-wrapped stuff to ignore
 %ignore dsp::IOManager::add_extensions(Extensions*);
 %ignore dsp::IOManager::combine(const Operation*);
@@ -78,6 +184,26 @@ void pointer_tracker_remove(Reference::Able *ptr) {
 %ignore dsp::Convolution::Convolution(const char *, Behaviour);
 %ignore dsp::Detection::set_engine(Engine*);
 %ignore dsp::Observation::verbose_nbytes(uint64_t) const;
+%ignore dsp::SingleThread::cerr;
+%ignore dsp::SingleThread::take_ostream(std::ostream*);
+%ignore dsp::SingleThread::Config::add_options(CommandLine::Menu&);
+%ignore dsp::SingleThread::Config::open(int, char**);
+%ignore dsp::SingleThread::Config::input_prepare;
+%ignore dsp::SingleThread::Config::editor;
+%ignore dsp::LoadToFold::Config::ephemerides;
+%ignore dsp::LoadToFold::Config::predictors;
+%ignore dsp::PipelineStream::add_observer(const std::string&, Observer*);
+
+// Nested classes are flattened into the module namespace
+%rename(SingleThread_Config) dsp::SingleThread::Config;
+%rename(LoadToFil_Config) dsp::LoadToFil::Config;
+%rename(LoadToFold_Config) dsp::LoadToFold::Config;
+%rename(PipelineStream_Observer) dsp::PipelineStream::Observer;
+
+// Return the most derived type of the TimeSeries returned by next
+%typemap(out) const dsp::TimeSeries* next {
+    $result = wrap_time_series ($1);
+}
 
 // Return psrchive's Estimate class as a Python tuple
 %typemap(out) Estimate<double> {
@@ -126,6 +252,16 @@ void pointer_tracker_remove(Reference::Able *ptr) {
 %include "dsp/Dedispersion.h"
 %include "dsp/Response.h"
 %include "dsp/Convolution.h"
+%include "dsp/PhaseSeries.h"
+%include "dsp/Pipeline.h"
+%include "dsp/SingleThread.h"
+%include "dsp/MultiThread.h"
+%include "dsp/LoadToFil.h"
+%include "dsp/LoadToFilN.h"
+%include "dsp/LoadToFold1.h"
+%include "dsp/LoadToFoldConfig.h"
+%include "dsp/LoadToFoldN.h"
+%include "dsp/PipelineStream.h"
 
 // Python-specific extensions to the classes:
 %extend dsp::TimeSeries
@@ -152,4 +288,92 @@ void pointer_tracker_remove(Reference::Able *ptr) {
     {
         return self->get_start_time().fracday();
     }
+
+    // Return a numpy array view of the data in TFP order,
+    // with dimensions (ndat, nchan, npol, ndim).
+    PyObject *get_tfp()
+    {
+        if (self->get_order() != dsp::TimeSeries::OrderTFP)
+            throw Error (InvalidState, "TimeSeries::get_tfp",
+                         "data are not in TFP order");
+
+        npy_intp dims[4];
+        dims[0] = self->get_ndat();
+        dims[1] = self->get_nchan();
+        dims[2] = self->get_npol();
+        dims[3] = self->get_ndim();
+        float *ptr = self->get_dattfp();
+        return PyArray_SimpleNewFromData(4, dims, PyArray_FLOAT, (char *)ptr);
+    }
+}
+
+%extend dsp::PhaseSeries
+{
+    // Return a numpy array view of the hits in each phase bin
+    PyObject *get_hits(unsigned ichan)
+    {
+        npy_intp dims[1];
+        dims[0] = self->get_nbin();
+        unsigned *ptr = self->get_hits(ichan);
+        return PyArray_SimpleNewFromData(1, dims, NPY_UINT, (char *)ptr);
+    }
+}
+
+%extend dsp::LoadToFil::Config
+{
+    // Set the number of channels output by the filterbank
+    void set_nchan(unsigned nchan)
+    {
+        self->filterbank.set_nchan(nchan);
+    }
+}
+
+%extend dsp::LoadToFold::Config
+{
+    // Set the number of channels output by the filterbank
+    void set_nchan(unsigned nchan)
+    {
+        self->filterbank.set_nchan(nchan);
+    }
+}
+
+%extend dsp::Pipeline
+{
+    // Open the named file, then construct and prepare the pipeline
+    void open(const std::string& filename)
+    {
+        self->set_input( dsp::File::create(filename) );
+        self->construct();
+        self->prepare();
+    }
+}
+
+%extend dsp::PipelineStream
+{
+    // Call the Python function after each block of the named operation
+    void add_callback(const std::string& name, PyObject *callable)
+    {
+        if (!PyCallable_Check(callable))
+            throw Error (InvalidParam, "PipelineStream::add_callback",
+                         "callback is not callable");
+
+        self->add_observer (name, new PythonObserver(callable));
+    }
+
+%pythoncode %{
+    def __iter__(self):
+        """Yield each block of output from the watched operations.
+
+        Each block is a view of the pipeline memory; it remains valid
+        only until the next iteration, during which the pipeline runs
+        with the interpreter lock released."""
+        try:
+            while True:
+                block = self.next()
+                if block is None:
+                    return
+                yield block
+        finally:
+            self.stop()
+%}
 }
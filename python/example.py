@@ -33,3 +33,31 @@ print "Data have dimensions", data.get_dat(0,0).shape
 while loader.operate():
     print "The max value for this block is", \
             data.get_dat(0,0).max()
+
+## To run an entire pipeline natively, with the Python interpreter
+## lock released, configure and open one of the standard pipelines;
+## e.g. the digifil pipeline, with 256 channels:
+config = dspsr.LoadToFil_Config()
+config.set_nchan(256)
+
+pipeline = dspsr.LoadToFil(config)
+pipeline.open('TPUL0001_Lband_raw.57324.89902427084.4774.B1937+21.AC-00.0000.raw')
+
+## A PipelineStream runs the pipeline in a background thread and
+## yields the output of the watched operations as each block is
+## computed.  The arrays are views of the pipeline memory, valid
+## until the next iteration:
+stream = dspsr.PipelineStream(pipeline)
+stream.watch('Detection')
+
+## Callbacks are called in the processing thread after each block
+## of the named operation:
+def report(name, data):
+    print name, "output", data.get_ndat(), "samples"
+
+stream.add_callback('Filterbank', report)
+
+for block in stream:
+    print "The mean power in channel 0 is", block.get_dat(0,0).mean()
+
+stream.wait()